@@ -0,0 +1,33 @@
+#include "perft.h"
+#include "searchBenchmark.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// Testy wydajnosci silnika bez interfejsu graficznego, np. na serwerze:
+//   warcaby_bench perft <glebokosc> [watki]
+//   warcaby_bench skalowanie <glebokosc> [lazy|ybwc]
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && std::strcmp(argv[1], "perft") == 0) {
+        int depth = std::atoi(argv[2]);
+        int threads = argc >= 4 ? std::atoi(argv[3]) : 1;
+
+        Perft perft(threads);
+        Perft::printResult(perft.run(Board(), depth), true);
+        return 0;
+    }
+
+    if (argc >= 3 && std::strcmp(argv[1], "skalowanie") == 0) {
+        int depth = std::atoi(argv[2]);
+        bool ybwc = argc >= 4 && std::strcmp(argv[3], "ybwc") == 0;
+
+        SearchBenchmark benchmark(depth, ybwc ? ParallelMode::YBWC : ParallelMode::LAZY_SMP);
+        SearchBenchmark::printResults(benchmark.run({1, 8, 16, 32}));
+        return 0;
+    }
+
+    std::cout << "Uzycie:\n"
+              << "  " << argv[0] << " perft <glebokosc> [watki]\n"
+              << "  " << argv[0] << " skalowanie <glebokosc> [lazy|ybwc]\n";
+    return 1;
+}
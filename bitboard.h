@@ -0,0 +1,110 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+// Bit i odpowiada i-temu ciemnemu polu liczac wierszami od gory (4 pola na wiersz).
+using Bitboard = uint32_t;
+
+constexpr int NUM_SQUARES = 32;
+
+constexpr int squareIndex(int row, int col) {
+    return row * 4 + col / 2;
+}
+
+constexpr int squareRow(int square) {
+    return square / 4;
+}
+
+constexpr int squareCol(int square) {
+    return 2 * (square % 4) + 1 - squareRow(square) % 2;
+}
+
+constexpr Bitboard squareBit(int square) {
+    return Bitboard(1) << square;
+}
+
+inline int popCount(Bitboard bb) {
+    return std::popcount(bb);
+}
+
+inline int popLowestSquare(Bitboard& bb) {
+    int square = std::countr_zero(bb);
+    bb &= bb - 1;
+    return square;
+}
+
+// Kierunki: 0-1 w gore planszy (malejace indeksy pol), 2-3 w dol (rosnace).
+enum Direction { UP_LEFT = 0, UP_RIGHT = 1, DOWN_LEFT = 2, DOWN_RIGHT = 3 };
+
+constexpr int NUM_DIRECTIONS = 4;
+
+struct RayTables {
+    std::array<std::array<int8_t, NUM_DIRECTIONS>, NUM_SQUARES> neighbor{};
+    std::array<std::array<Bitboard, NUM_DIRECTIONS>, NUM_SQUARES> ray{};
+};
+
+constexpr RayTables makeRayTables() {
+    constexpr int delta[NUM_DIRECTIONS][2] = {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
+    RayTables tables;
+    for (int square = 0; square < NUM_SQUARES; square++) {
+        for (int dir = 0; dir < NUM_DIRECTIONS; dir++) {
+            int row = squareRow(square) + delta[dir][0];
+            int col = squareCol(square) + delta[dir][1];
+            tables.neighbor[square][dir] = -1;
+            if (row >= 0 && row < 8 && col >= 0 && col < 8) {
+                tables.neighbor[square][dir] = static_cast<int8_t>(squareIndex(row, col));
+            }
+            while (row >= 0 && row < 8 && col >= 0 && col < 8) {
+                tables.ray[square][dir] |= squareBit(squareIndex(row, col));
+                row += delta[dir][0];
+                col += delta[dir][1];
+            }
+        }
+    }
+    return tables;
+}
+
+inline constexpr RayTables RAYS = makeRayTables();
+
+constexpr Bitboard EVEN_ROWS = 0x0F0F0F0Fu;
+constexpr Bitboard ODD_ROWS = 0xF0F0F0F0u;
+constexpr Bitboard LEFT_EDGE = 0x10101010u;
+constexpr Bitboard RIGHT_EDGE = 0x08080808u;
+
+// Przesuwa wszystkie bity o jedno pole po przekatnej. W wierszach parzystych
+// sasiedzi leza o 4/3 (w gore) i 4/5 (w dol) pola dalej, w nieparzystych o 5/4 i 3/4.
+template<int Dir>
+constexpr Bitboard shiftBoard(Bitboard bb) {
+    if constexpr (Dir == UP_LEFT) {
+        return ((bb & EVEN_ROWS) >> 4) | ((bb & ODD_ROWS & ~LEFT_EDGE) >> 5);
+    } else if constexpr (Dir == UP_RIGHT) {
+        return ((bb & EVEN_ROWS & ~RIGHT_EDGE) >> 3) | ((bb & ODD_ROWS) >> 4);
+    } else if constexpr (Dir == DOWN_LEFT) {
+        return ((bb & EVEN_ROWS) << 4) | ((bb & ODD_ROWS & ~LEFT_EDGE) << 3);
+    } else {
+        return ((bb & EVEN_ROWS & ~RIGHT_EDGE) << 5) | ((bb & ODD_ROWS) << 4);
+    }
+}
+
+inline int neighborSquare(int square, int dir) {
+    return RAYS.neighbor[square][dir];
+}
+
+// Najblizsza bierka na promieniu: w gore to najstarszy bit, w dol najmlodszy.
+inline int nearestSquare(Bitboard blockers, int dir) {
+    return dir < DOWN_LEFT ? 31 - std::countl_zero(blockers) : std::countr_zero(blockers);
+}
+
+// Wolne pola promienia az do pierwszej zajetej bierki (bez niej).
+inline Bitboard slidingMoves(int square, int dir, Bitboard occupied) {
+    Bitboard ray = RAYS.ray[square][dir];
+    Bitboard blockers = ray & occupied;
+    if (!blockers) return ray;
+    int blocker = nearestSquare(blockers, dir);
+    return ray & ~(RAYS.ray[blocker][dir] | squareBit(blocker));
+}
+
+#endif
@@ -1,34 +1,48 @@
 #include "Board.h"
 #include <iomanip>
 
-Board::Board() : board(SIZE, std::vector<PieceType>(SIZE, PieceType::EMPTY)) {
+namespace {
+uint64_t pieceKey(PieceType piece, int square) {
+    return ZOBRIST.piece[static_cast<int>(piece) - 1][square];
+}
+
+int pieceValue(PieceType piece, int square) {
+    return PST.value[static_cast<int>(piece) - 1][square];
+}
+}
+
+Board::Board()
+    : whitePawns(0), blackPawns(0), whiteKings(0), blackKings(0), hash(0), pieceScore(0), whiteToMove(true) {
     initializeBoard();
 }
 
 void Board::initializeBoard() {
+    // Wiersze 0-2 to pola 0-11, wiersze 5-7 to pola 20-31
+    blackPawns = 0x00000FFFu;
+    whitePawns = 0xFFF00000u;
+    whiteKings = 0;
+    blackKings = 0;
+    whiteToMove = true;
+    hash = computeHash();
+    pieceScore = computePieceScore();
+}
 
-    for (int i = 0; i < SIZE; i++) {
-        for (int j = 0; j < SIZE; j++) {
-            board[i][j] = PieceType::EMPTY;
-        }
-    }
-    
-
-    for (int row = 0; row < 3; row++) {
-        for (int col = 0; col < SIZE; col++) {
-            if (isDarkSquare(row, col)) {
-                board[row][col] = PieceType::BLACK_PAWN;
-            }
-        }
+uint64_t Board::computeHash() const {
+    uint64_t key = zobristMaskKey(static_cast<int>(PieceType::WHITE_PAWN) - 1, whitePawns) ^
+                   zobristMaskKey(static_cast<int>(PieceType::BLACK_PAWN) - 1, blackPawns) ^
+                   zobristMaskKey(static_cast<int>(PieceType::WHITE_KING) - 1, whiteKings) ^
+                   zobristMaskKey(static_cast<int>(PieceType::BLACK_KING) - 1, blackKings);
+    if (!whiteToMove) {
+        key ^= ZOBRIST.blackToMove;
     }
+    return key;
+}
 
-    for (int row = 5; row < SIZE; row++) {
-        for (int col = 0; col < SIZE; col++) {
-            if (isDarkSquare(row, col)) {
-                board[row][col] = PieceType::WHITE_PAWN;
-            }
-        }
-    }
+int Board::computePieceScore() const {
+    return pieceSquareMaskValue(static_cast<int>(PieceType::WHITE_PAWN) - 1, whitePawns) +
+           pieceSquareMaskValue(static_cast<int>(PieceType::BLACK_PAWN) - 1, blackPawns) +
+           pieceSquareMaskValue(static_cast<int>(PieceType::WHITE_KING) - 1, whiteKings) +
+           pieceSquareMaskValue(static_cast<int>(PieceType::BLACK_KING) - 1, blackKings);
 }
 
 void Board::displayBoard() const {
@@ -43,7 +57,7 @@ void Board::displayBoard() const {
         for (int col = 0; col < SIZE; col++) {
             if (isDarkSquare(row, col)) {
                 char symbol = ' ';
-                switch (board[row][col]) {
+                switch (pieceAt(squareIndex(row, col))) {
                     case PieceType::WHITE_PAWN: symbol = 'o'; break;
                     case PieceType::BLACK_PAWN: symbol = 'x'; break;
                     case PieceType::WHITE_KING: symbol = 'O'; break;
@@ -62,18 +76,57 @@ void Board::displayBoard() const {
 }
 
 PieceType Board::getPiece(int row, int col) const {
-    if (isValidPosition(row, col)) {
-        return board[row][col];
+    if (isValidPosition(row, col) && isDarkSquare(row, col)) {
+        return pieceAt(squareIndex(row, col));
     }
     return PieceType::EMPTY;
 }
 
 void Board::setPiece(int row, int col, PieceType piece) {
-    if (isValidPosition(row, col)) {
-        board[row][col] = piece;
+    if (isValidPosition(row, col) && isDarkSquare(row, col)) {
+        placePiece(squareIndex(row, col), piece);
+    }
+}
+
+void Board::placePiece(int square, PieceType piece) {
+    PieceType previous = pieceAt(square);
+    if (previous != PieceType::EMPTY) {
+        hash ^= pieceKey(previous, square);
+        pieceScore -= pieceValue(previous, square);
+    }
+    if (piece != PieceType::EMPTY) {
+        hash ^= pieceKey(piece, square);
+        pieceScore += pieceValue(piece, square);
+    }
+
+    Bitboard bit = squareBit(square);
+    whitePawns &= ~bit;
+    blackPawns &= ~bit;
+    whiteKings &= ~bit;
+    blackKings &= ~bit;
+
+    switch (piece) {
+        case PieceType::WHITE_PAWN: whitePawns |= bit; break;
+        case PieceType::BLACK_PAWN: blackPawns |= bit; break;
+        case PieceType::WHITE_KING: whiteKings |= bit; break;
+        case PieceType::BLACK_KING: blackKings |= bit; break;
+        default: break;
     }
 }
 
+PieceType Board::pieceAt(int square) const {
+    Bitboard bit = squareBit(square);
+    if (whitePawns & bit) return PieceType::WHITE_PAWN;
+    if (blackPawns & bit) return PieceType::BLACK_PAWN;
+    if (whiteKings & bit) return PieceType::WHITE_KING;
+    if (blackKings & bit) return PieceType::BLACK_KING;
+    return PieceType::EMPTY;
+}
+
+Bitboard Board::piecesOf(bool isWhite) const {
+    return isWhite ? (whitePawns | whiteKings) : (blackPawns | blackKings);
+}
+
 bool Board::isValidPosition(int row, int col) const {
     return row >= 0 && row < SIZE && col >= 0 && col < SIZE;
 }
@@ -82,195 +135,268 @@ bool Board::isDarkSquare(int row, int col) const {
     return (row + col) % 2 == 1;
 }
 
-std::vector<Move> Board::getAllMoves(bool isWhite) const {
-    std::vector<Move> captures = getCaptureMoves(isWhite);
-    if (!captures.empty()) {
-        return captures;
-    }
-    return getRegularMoves(isWhite);
+MoveList Board::getAllMoves(bool isWhite) const {
+    return isWhite ? generateMoves<Color::WHITE>() : generateMoves<Color::BLACK>();
 }
 
-std::vector<Move> Board::getCaptureMoves(bool isWhite) const {
-    std::vector<Move> moves;
-    
-    for (int row = 0; row < SIZE; row++) {
-        for (int col = 0; col < SIZE; col++) {
-            PieceType piece = board[row][col];
-            if ((isWhite && isWhitePiece(piece)) || (!isWhite && isBlackPiece(piece))) {
-                std::vector<Move> pieceMoves;
-                if (isKing(piece)) {
-                    pieceMoves = getKingCaptures(row, col);
-                } else {
-                    pieceMoves = getPawnCaptures(row, col);
-                }
-                moves.insert(moves.end(), pieceMoves.begin(), pieceMoves.end());
-            }
-        }
+MoveList Board::getCaptureMoves(bool isWhite) const {
+    MoveList moves;
+    if (isWhite) {
+        generateCaptures<Color::WHITE>(moves);
+    } else {
+        generateCaptures<Color::BLACK>(moves);
     }
-    
     return moves;
 }
 
-std::vector<Move> Board::getRegularMoves(bool isWhite) const {
-    std::vector<Move> moves;
-    
-    for (int row = 0; row < SIZE; row++) {
-        for (int col = 0; col < SIZE; col++) {
-            PieceType piece = board[row][col];
-            if ((isWhite && isWhitePiece(piece)) || (!isWhite && isBlackPiece(piece))) {
-                std::vector<Move> pieceMoves;
-                if (isKing(piece)) {
-                    pieceMoves = getKingMoves(row, col);
-                } else {
-                    pieceMoves = getPawnMoves(row, col);
-                }
-                moves.insert(moves.end(), pieceMoves.begin(), pieceMoves.end());
-            }
-        }
+MoveList Board::getRegularMoves(bool isWhite) const {
+    MoveList moves;
+    if (isWhite) {
+        generateRegularMoves<Color::WHITE>(moves);
+    } else {
+        generateRegularMoves<Color::BLACK>(moves);
     }
-    
     return moves;
 }
 
-std::vector<Move> Board::getPawnMoves(int row, int col) const {
-    std::vector<Move> moves;
-    PieceType piece = board[row][col];
-    
-    int direction = isWhitePiece(piece) ? -1 : 1;
-
-    for (int dcol = -1; dcol <= 1; dcol += 2) {
-        int newRow = row + direction;
-        int newCol = col + dcol;
-        
-        if (isValidPosition(newRow, newCol) && isDarkSquare(newRow, newCol) && 
-            board[newRow][newCol] == PieceType::EMPTY) {
-            moves.push_back(Move(Position(row, col), Position(newRow, newCol)));
-        }
+template<Color C>
+MoveList Board::generateMoves() const {
+    MoveList moves;
+    generateCaptures<C>(moves);
+    if (moves.empty()) {
+        generateRegularMoves<C>(moves);
     }
-    
     return moves;
 }
 
-std::vector<Move> Board::getKingMoves(int row, int col) const {
-    std::vector<Move> moves;
+template<Color C>
+void Board::generateCaptures(MoveList& moves) const {
+    Bitboard own = pawns<C>();
+    while (own) {
+        addCaptureChains<C>(popLowestSquare(own), false, moves);
+    }
+    own = kings<C>();
+    while (own) {
+        addCaptureChains<C>(popLowestSquare(own), true, moves);
+    }
+}
 
-    int directions[][2] = {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
-    
-    for (auto& dir : directions) {
-        for (int dist = 1; dist < SIZE; dist++) {
-            int newRow = row + dir[0] * dist;
-            int newCol = col + dir[1] * dist;
-            
-            if (!isValidPosition(newRow, newCol) || !isDarkSquare(newRow, newCol)) {
-                break;
-            }
-            
-            if (board[newRow][newCol] != PieceType::EMPTY) {
-                break;
-            }
-            
-            moves.push_back(Move(Position(row, col), Position(newRow, newCol)));
+template<Color C>
+void Board::generateRegularMoves(MoveList& moves) const {
+    Bitboard own = pawns<C>();
+    while (own) {
+        addPawnMoves<C>(popLowestSquare(own), moves);
+    }
+    own = kings<C>();
+    while (own) {
+        addKingMoves(popLowestSquare(own), moves);
+    }
+}
+
+template<Color C>
+void Board::addPawnMoves(int square, MoveList& moves) const {
+    constexpr int firstDir = C == Color::WHITE ? UP_LEFT : DOWN_LEFT;
+    Bitboard empty = ~occupied();
+
+    for (int dir = firstDir; dir < firstDir + 2; dir++) {
+        int target = neighborSquare(square, dir);
+        if (target >= 0 && (empty & squareBit(target))) {
+            moves.add(Move(square, target));
         }
     }
-    
-    return moves;
 }
 
-std::vector<Move> Board::getPawnCaptures(int row, int col) const {
-    std::vector<Move> moves;
-    PieceType piece = board[row][col];
+void Board::addKingMoves(int square, MoveList& moves) const {
+    Bitboard all = occupied();
+    Bitboard targets = 0;
 
-    int directions[][2] = {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
-    
-    for (auto& dir : directions) {
-        int enemyRow = row + dir[0];
-        int enemyCol = col + dir[1];
-        int landRow = row + 2 * dir[0];
-        int landCol = col + 2 * dir[1];
-        
-        if (isValidPosition(enemyRow, enemyCol) && isValidPosition(landRow, landCol) &&
-            isDarkSquare(landRow, landCol) && board[landRow][landCol] == PieceType::EMPTY) {
-            
-            PieceType enemy = board[enemyRow][enemyCol];
-            if ((isWhitePiece(piece) && isBlackPiece(enemy)) ||
-                (isBlackPiece(piece) && isWhitePiece(enemy))) {
-                
-                Move move(Position(row, col), Position(landRow, landCol));
-                move.captured.push_back(Position(enemyRow, enemyCol));
-                moves.push_back(move);
-            }
+    for (int dir = 0; dir < NUM_DIRECTIONS; dir++) {
+        targets |= slidingMoves(square, dir, all);
+    }
+    while (targets) {
+        moves.add(Move(square, popLowestSquare(targets)));
+    }
+}
+
+namespace {
+const int MAX_CHAIN = 12;
+
+struct CaptureFrame {
+    int square;
+    Bitboard captured;
+    int direction;
+    int victim;
+    Bitboard landings;
+    bool extended;
+};
+}
+
+// Szuka bicia z pola square w danym kierunku. Zwraca pole zbijanego pionka
+// i maske pol, na ktorych mozna wyladowac (dla pionka co najwyzej jedno).
+int Board::findCapture(int square, int direction, bool king, Bitboard occupied,
+                       Bitboard enemies, Bitboard& landings) const {
+    landings = 0;
+
+    int victim;
+    if (king) {
+        Bitboard blockers = RAYS.ray[square][direction] & occupied;
+        if (!blockers) return -1;
+        victim = nearestSquare(blockers, direction);
+    } else {
+        victim = neighborSquare(square, direction);
+    }
+    if (victim < 0 || !(enemies & squareBit(victim))) {
+        return -1;
+    }
+
+    if (king) {
+        landings = slidingMoves(victim, direction, occupied);
+    } else {
+        int landing = neighborSquare(victim, direction);
+        if (landing >= 0 && !(occupied & squareBit(landing))) {
+            landings = squareBit(landing);
         }
     }
-    
-    return moves;
+    return landings ? victim : -1;
 }
 
-std::vector<Move> Board::getKingCaptures(int row, int col) const {
-    std::vector<Move> moves;
-    PieceType piece = board[row][col];
-    
-    int directions[][2] = {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
-    
-    for (auto& dir : directions) {
-        Position enemy(-1, -1);
-        bool foundEnemy = false;
-
-        for (int dist = 1; dist < SIZE; dist++) {
-            int checkRow = row + dir[0] * dist;
-            int checkCol = col + dir[1] * dist;
-            
-            if (!isValidPosition(checkRow, checkCol) || !isDarkSquare(checkRow, checkCol)) {
-                break;
-            }
-            
-            PieceType checkPiece = board[checkRow][checkCol];
-            if (checkPiece != PieceType::EMPTY) {
-                if (!foundEnemy && ((isWhitePiece(piece) && isBlackPiece(checkPiece)) ||
-                                   (isBlackPiece(piece) && isWhitePiece(checkPiece)))) {
-                    enemy = Position(checkRow, checkCol);
-                    foundEnemy = true;
-                } else {
+// Generuje pelne sekwencje bic iteracyjnym DFS-em. Bierka jest zdjeta z pola
+// startowego, a zbite pionki zostaja na planszy do konca ruchu (nie mozna ich
+// przeskoczyc drugi raz). Sciezki konczace sie na tym samym polu z tym samym
+// zbiorem zbitych bierek daja jeden ruch.
+template<Color C>
+void Board::addCaptureChains(int from, bool king, MoveList& moves) const {
+    Bitboard enemies = pieces<opponent(C)>();
+    Bitboard blockers = occupied() & ~squareBit(from);
+    int firstMove = moves.size();
+
+    CaptureFrame stack[MAX_CHAIN + 1];
+    int top = 0;
+    stack[0] = {from, 0, 0, -1, 0, false};
+
+    while (top >= 0) {
+        CaptureFrame& frame = stack[top];
+
+        if (frame.landings) {
+            int landing = popLowestSquare(frame.landings);
+            frame.extended = true;
+            stack[top + 1] = {landing, frame.captured | squareBit(frame.victim), 0, -1, 0, false};
+            top++;
+            continue;
+        }
+
+        if (frame.direction < NUM_DIRECTIONS) {
+            frame.victim = findCapture(frame.square, frame.direction, king, blockers,
+                                       enemies & ~frame.captured, frame.landings);
+            frame.direction++;
+            continue;
+        }
+
+        if (!frame.extended && frame.captured) {
+            bool duplicate = false;
+            for (int i = firstMove; i < moves.size(); i++) {
+                if (moves[i].to == frame.square && moves[i].captured == frame.captured) {
+                    duplicate = true;
                     break;
                 }
-            } else if (foundEnemy) {
-                Move move(Position(row, col), Position(checkRow, checkCol));
-                move.captured.push_back(enemy);
-                moves.push_back(move);
+            }
+            if (!duplicate) {
+                moves.add(Move(from, frame.square, frame.captured));
             }
         }
+        top--;
     }
-    
-    return moves;
 }
 
-bool Board::makeMove(const Move& move) {
-    PieceType piece = board[move.from.row][move.from.col];
-    if (piece == PieceType::EMPTY) return false;
+template MoveList Board::generateMoves<Color::WHITE>() const;
+template MoveList Board::generateMoves<Color::BLACK>() const;
+template void Board::generateCaptures<Color::WHITE>(MoveList& moves) const;
+template void Board::generateCaptures<Color::BLACK>(MoveList& moves) const;
+template void Board::generateRegularMoves<Color::WHITE>(MoveList& moves) const;
+template void Board::generateRegularMoves<Color::BLACK>(MoveList& moves) const;
+
+MoveUndo Board::makeMove(const Move& move) {
+    MoveUndo undo{};
+    undo.from = move.from;
+    undo.to = move.to;
+    undo.piece = pieceAt(move.from);
+    if (undo.piece == PieceType::EMPTY) return undo;
+
+    Bitboard captured = move.captured;
+
+    Bitboard& enemyPawns = isWhitePiece(undo.piece) ? blackPawns : whitePawns;
+    Bitboard& enemyKings = isWhitePiece(undo.piece) ? blackKings : whiteKings;
+    undo.capturedPawns = enemyPawns & captured;
+    undo.capturedKings = enemyKings & captured;
+    enemyPawns &= ~captured;
+    enemyKings &= ~captured;
+    hash ^= capturedKey(undo);
+    pieceScore -= capturedScore(undo);
+
+    placePiece(undo.from, PieceType::EMPTY);
+    placePiece(undo.to, undo.piece);
+    undo.promoted = promoteToKing(squareRow(move.to), squareCol(move.to));
+
+    whiteToMove = !whiteToMove;
+    hash ^= ZOBRIST.blackToMove;
+    assert(hash == computeHash());
+    assert(pieceScore == computePieceScore());
+
+    return undo;
+}
+
+void Board::unmakeMove(const MoveUndo& undo) {
+    if (undo.piece == PieceType::EMPTY) return;
 
-    board[move.to.row][move.to.col] = piece;
-    board[move.from.row][move.from.col] = PieceType::EMPTY;
+    placePiece(undo.to, PieceType::EMPTY);
+    placePiece(undo.from, undo.piece);
 
-    for (const Position& cap : move.captured) {
-        board[cap.row][cap.col] = PieceType::EMPTY;
+    if (isWhitePiece(undo.piece)) {
+        blackPawns |= undo.capturedPawns;
+        blackKings |= undo.capturedKings;
+    } else {
+        whitePawns |= undo.capturedPawns;
+        whiteKings |= undo.capturedKings;
     }
+    hash ^= capturedKey(undo);
+    pieceScore += capturedScore(undo);
 
-    promoteToKing(move.to.row, move.to.col);
-    
-    return true;
+    whiteToMove = !whiteToMove;
+    hash ^= ZOBRIST.blackToMove;
+    assert(hash == computeHash());
+    assert(pieceScore == computePieceScore());
+}
+
+uint64_t Board::capturedKey(const MoveUndo& undo) const {
+    PieceType pawn = isWhitePiece(undo.piece) ? PieceType::BLACK_PAWN : PieceType::WHITE_PAWN;
+    PieceType king = isWhitePiece(undo.piece) ? PieceType::BLACK_KING : PieceType::WHITE_KING;
+    return zobristMaskKey(static_cast<int>(pawn) - 1, undo.capturedPawns) ^
+           zobristMaskKey(static_cast<int>(king) - 1, undo.capturedKings);
+}
+
+int Board::capturedScore(const MoveUndo& undo) const {
+    PieceType pawn = isWhitePiece(undo.piece) ? PieceType::BLACK_PAWN : PieceType::WHITE_PAWN;
+    PieceType king = isWhitePiece(undo.piece) ? PieceType::BLACK_KING : PieceType::WHITE_KING;
+    return pieceSquareMaskValue(static_cast<int>(pawn) - 1, undo.capturedPawns) +
+           pieceSquareMaskValue(static_cast<int>(king) - 1, undo.capturedKings);
 }
 
-void Board::promoteToKing(int row, int col) {
-    PieceType piece = board[row][col];
-    if (piece == PieceType::WHITE_PAWN && row == 0) {
-        board[row][col] = PieceType::WHITE_KING;
-    } else if (piece == PieceType::BLACK_PAWN && row == SIZE - 1) {
-        board[row][col] = PieceType::BLACK_KING;
+bool Board::promoteToKing(int row, int col) {
+    Bitboard bit = squareBit(squareIndex(row, col));
+    if ((whitePawns & bit) && row == 0) {
+        placePiece(squareIndex(row, col), PieceType::WHITE_KING);
+        return true;
+    }
+    if ((blackPawns & bit) && row == SIZE - 1) {
+        placePiece(squareIndex(row, col), PieceType::BLACK_KING);
+        return true;
     }
+    return false;
 }
 
 bool Board::isGameOver(bool& whiteWins) const {
-    bool hasWhite = countPieces(true) > 0;
-    bool hasBlack = countPieces(false) > 0;
+    bool hasWhite = (whitePawns | whiteKings) != 0;
+    bool hasBlack = (blackPawns | blackKings) != 0;
     
     if (!hasWhite) {
         whiteWins = false;
@@ -281,14 +407,11 @@ bool Board::isGameOver(bool& whiteWins) const {
         return true;
     }
 
-    bool whiteMoves = !getAllMoves(true).empty();
-    bool blackMoves = !getAllMoves(false).empty();
-    
-    if (!whiteMoves) {
+    if (!hasAnyMove<Color::WHITE>()) {
         whiteWins = false;
         return true;
     }
-    if (!blackMoves) {
+    if (!hasAnyMove<Color::BLACK>()) {
         whiteWins = true;
         return true;
     }
@@ -296,27 +419,43 @@ bool Board::isGameOver(bool& whiteWins) const {
     return false;
 }
 
-int Board::countPieces(bool isWhite) const {
-    int count = 0;
-    for (int row = 0; row < SIZE; row++) {
-        for (int col = 0; col < SIZE; col++) {
-            PieceType piece = board[row][col];
-            if ((isWhite && isWhitePiece(piece)) || (!isWhite && isBlackPiece(piece))) {
-                count++;
-            }
-        }
-    }
-    return count;
+bool Board::hasAnyMove(bool isWhite) const {
+    return isWhite ? hasAnyMove<Color::WHITE>() : hasAnyMove<Color::BLACK>();
 }
 
-bool Board::isWhitePiece(PieceType piece) const {
-    return piece == PieceType::WHITE_PAWN || piece == PieceType::WHITE_KING;
+// Damka bijaca z odleglosci ma wolne pole obok siebie, wiec wystarczy sprawdzic
+// zwykle ruchy o jedno pole i bicia sasiadujacych bierek.
+template<Color C>
+bool Board::hasAnyMove() const {
+    Bitboard empty = ~occupied();
+    Bitboard own = pieces<C>();
+    Bitboard enemies = pieces<opponent(C)>();
+
+    Bitboard forward;
+    if constexpr (C == Color::WHITE) {
+        forward = shiftBoard<UP_LEFT>(pawns<C>()) | shiftBoard<UP_RIGHT>(pawns<C>());
+    } else {
+        forward = shiftBoard<DOWN_LEFT>(pawns<C>()) | shiftBoard<DOWN_RIGHT>(pawns<C>());
+    }
+    Bitboard kingSteps = shiftBoard<UP_LEFT>(kings<C>()) | shiftBoard<UP_RIGHT>(kings<C>()) |
+                         shiftBoard<DOWN_LEFT>(kings<C>()) | shiftBoard<DOWN_RIGHT>(kings<C>());
+    if ((forward | kingSteps) & empty) {
+        return true;
+    }
+
+    return ((shiftBoard<UP_LEFT>(shiftBoard<UP_LEFT>(own) & enemies) |
+             shiftBoard<UP_RIGHT>(shiftBoard<UP_RIGHT>(own) & enemies) |
+             shiftBoard<DOWN_LEFT>(shiftBoard<DOWN_LEFT>(own) & enemies) |
+             shiftBoard<DOWN_RIGHT>(shiftBoard<DOWN_RIGHT>(own) & enemies)) & empty) != 0;
 }
 
-bool Board::isBlackPiece(PieceType piece) const {
-    return piece == PieceType::BLACK_PAWN || piece == PieceType::BLACK_KING;
+template bool Board::hasAnyMove<Color::WHITE>() const;
+template bool Board::hasAnyMove<Color::BLACK>() const;
+
+int Board::countPieces(bool isWhite) const {
+    return popCount(piecesOf(isWhite));
 }
 
-bool Board::isKing(PieceType piece) const {
-    return piece == PieceType::WHITE_KING || piece == PieceType::BLACK_KING;
+bool Board::isWhitePiece(PieceType piece) const {
+    return piece == PieceType::WHITE_PAWN || piece == PieceType::WHITE_KING;
 }
\ No newline at end of file
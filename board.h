@@ -1,6 +1,10 @@
 #ifndef BOARD_H
 #define BOARD_H
 
+#include "bitboard.h"
+#include "zobrist.h"
+#include "pieceSquareTables.h"
+#include <cassert>
 #include <vector>
 #include <iostream>
 
@@ -12,6 +16,15 @@ enum class PieceType {
     BLACK_KING = 4
 };
 
+enum class Color {
+    WHITE = 0,
+    BLACK = 1
+};
+
+constexpr Color opponent(Color color) {
+    return color == Color::WHITE ? Color::BLACK : Color::WHITE;
+}
+
 struct Position {
     int row, col;
     explicit Position(int r = 0, int c = 0) : row(r), col(c) {}
@@ -21,14 +34,61 @@ struct Position {
 };
 
 struct Move {
-    Position from, to;
-    std::vector<Position> captured;
-    Move(Position f, Position t) : from(f), to(t) {}
+    uint8_t from, to;
+    Bitboard captured;
+    Move() = default;
+    Move(int f, int t, Bitboard cap = 0) : from(f), to(t), captured(cap) {}
+    [[nodiscard]] Position fromPosition() const { return Position(squareRow(from), squareCol(from)); }
+    [[nodiscard]] Position toPosition() const { return Position(squareRow(to), squareCol(to)); }
+    [[nodiscard]] bool isCapture() const { return captured != 0; }
+    // Bicie moze wrocic na pole startowe, wiec pusty ruch to from == to bez bic
+    [[nodiscard]] bool isNull() const { return from == to && captured == 0; }
+    bool operator==(const Move& other) const {
+        return from == other.from && to == other.to && captured == other.captured;
+    }
+};
+
+class MoveList {
+public:
+    static const int CAPACITY = 128;
+
+private:
+    Move moves[CAPACITY];
+    int count;
+
+public:
+    MoveList() : count(0) {}
+    void add(const Move& move) {
+        assert(count < CAPACITY);
+        moves[count++] = move;
+    }
+    [[nodiscard]] int size() const { return count; }
+    [[nodiscard]] bool empty() const { return count == 0; }
+    Move& operator[](int index) { return moves[index]; }
+    const Move& operator[](int index) const { return moves[index]; }
+    Move* begin() { return moves; }
+    Move* end() { return moves + count; }
+    [[nodiscard]] const Move* begin() const { return moves; }
+    [[nodiscard]] const Move* end() const { return moves + count; }
+};
+
+struct MoveUndo {
+    uint8_t from, to;
+    PieceType piece;
+    bool promoted;
+    Bitboard capturedPawns;
+    Bitboard capturedKings;
 };
 
 class Board {
 private:
-    std::vector<std::vector<PieceType>> board;
+    Bitboard whitePawns;
+    Bitboard blackPawns;
+    Bitboard whiteKings;
+    Bitboard blackKings;
+    uint64_t hash;
+    int pieceScore; // material + tablice pozycyjne, biale minus czarne
+    bool whiteToMove;
     static const int SIZE = 8;
 
 public:
@@ -39,22 +99,50 @@ public:
     void setPiece(int row, int col, PieceType piece);
     [[nodiscard]] bool isValidPosition(int row, int col) const;
     [[nodiscard]] bool isDarkSquare(int row, int col) const;
-    [[nodiscard]] std::vector<Move> getAllMoves(bool isWhite) const;
-    [[nodiscard]] std::vector<Move> getCaptureMoves(bool isWhite) const;
-    [[nodiscard]] std::vector<Move> getRegularMoves(bool isWhite) const;
-    bool makeMove(const Move& move);
+    [[nodiscard]] MoveList getAllMoves(bool isWhite) const;
+    [[nodiscard]] MoveList getCaptureMoves(bool isWhite) const;
+    [[nodiscard]] MoveList getRegularMoves(bool isWhite) const;
+    template<Color C> [[nodiscard]] MoveList generateMoves() const;
+    template<Color C> void generateCaptures(MoveList& moves) const;
+    template<Color C> void generateRegularMoves(MoveList& moves) const;
+    MoveUndo makeMove(const Move& move);
+    void unmakeMove(const MoveUndo& undo);
     bool isGameOver(bool& whiteWins) const;
+    [[nodiscard]] bool hasAnyMove(bool isWhite) const;
+    template<Color C> [[nodiscard]] bool hasAnyMove() const;
     [[nodiscard]] int countPieces(bool isWhite) const;
+    [[nodiscard]] uint64_t getHash() const { return hash; }
+    [[nodiscard]] bool isWhiteToMove() const { return whiteToMove; }
+    [[nodiscard]] uint64_t computeHash() const;
+    [[nodiscard]] int getPieceScore() const { return pieceScore; }
+    [[nodiscard]] int computePieceScore() const;
+
+    template<Color C> [[nodiscard]] Bitboard pawns() const {
+        if constexpr (C == Color::WHITE) return whitePawns; else return blackPawns;
+    }
+    template<Color C> [[nodiscard]] Bitboard kings() const {
+        if constexpr (C == Color::WHITE) return whiteKings; else return blackKings;
+    }
+    template<Color C> [[nodiscard]] Bitboard pieces() const {
+        return pawns<C>() | kings<C>();
+    }
+    [[nodiscard]] Bitboard occupied() const {
+        return whitePawns | blackPawns | whiteKings | blackKings;
+    }
 
 private:
-    [[nodiscard]] std::vector<Move> getPawnMoves(int row, int col) const;
-    [[nodiscard]] std::vector<Move> getKingMoves(int row, int col) const;
-    [[nodiscard]] std::vector<Move> getPawnCaptures(int row, int col) const;
-    [[nodiscard]] std::vector<Move> getKingCaptures(int row, int col) const;
+    template<Color C> void addPawnMoves(int square, MoveList& moves) const;
+    void addKingMoves(int square, MoveList& moves) const;
+    template<Color C> void addCaptureChains(int from, bool king, MoveList& moves) const;
+    [[nodiscard]] int findCapture(int square, int direction, bool king, Bitboard occupied,
+                                  Bitboard enemies, Bitboard& landings) const;
     [[nodiscard]] bool isWhitePiece(PieceType piece) const;
-    [[nodiscard]] bool isBlackPiece(PieceType piece) const;
-    [[nodiscard]] bool isKing(PieceType piece) const;
-    void promoteToKing(int row, int col);
+    [[nodiscard]] PieceType pieceAt(int square) const;
+    [[nodiscard]] Bitboard piecesOf(bool isWhite) const;
+    void placePiece(int square, PieceType piece);
+    [[nodiscard]] uint64_t capturedKey(const MoveUndo& undo) const;
+    [[nodiscard]] int capturedScore(const MoveUndo& undo) const;
+    bool promoteToKing(int row, int col);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "evalCache.h"
+#include <algorithm>
+
+void EvalCache::resize(int sizeKb) {
+    entries.clear();
+    mask = 0;
+    if (sizeKb <= 0) {
+        return;
+    }
+
+    size_t count = 1;
+    size_t bytes = static_cast<size_t>(sizeKb) * 1024;
+    while (count * 2 * sizeof(uint64_t) <= bytes) {
+        count *= 2;
+    }
+    entries.resize(count);
+    mask = count - 1;
+    clear();
+}
+
+void EvalCache::clear() {
+    // Pusty wpis pasuje tylko do klucza z zerowymi starszymi 48 bitami
+    std::fill(entries.begin(), entries.end(), 0);
+}
@@ -0,0 +1,36 @@
+#ifndef EVALCACHE_H
+#define EVALCACHE_H
+
+#include <cstdint>
+#include <vector>
+
+// Pamiec ocen statycznych z bezposrednim mapowaniem, osobna dla kazdego watku.
+// Wpis to starsze 48 bitow klucza pozycji i 16-bitowa ocena w jednym slowie.
+class EvalCache {
+private:
+    std::vector<uint64_t> entries;
+    uint64_t mask;
+
+    static const uint64_t SCORE_BITS = 0xFFFF;
+
+public:
+    EvalCache() : mask(0) {}
+    void resize(int sizeKb);
+    void clear();
+    [[nodiscard]] bool enabled() const { return !entries.empty(); }
+
+    bool probe(uint64_t key, int& score) const {
+        uint64_t entry = entries[key & mask];
+        if ((entry & ~SCORE_BITS) != (key & ~SCORE_BITS)) {
+            return false;
+        }
+        score = static_cast<int16_t>(entry & SCORE_BITS);
+        return true;
+    }
+
+    void store(uint64_t key, int score) {
+        entries[key & mask] = (key & ~SCORE_BITS) | static_cast<uint16_t>(score);
+    }
+};
+
+#endif
@@ -0,0 +1,155 @@
+#include "evaluation.h"
+
+namespace {
+const int MOBILITY_WEIGHT = 1;
+const int BACK_RANK_WEIGHT = 2;
+const int RUNAWAY_WEIGHT = 3;
+const int EXPOSED_WEIGHT = 4;
+const int TEMPO_BONUS = 1;
+
+constexpr Bitboard WHITE_BACK_RANK = 0xF0000000u;
+constexpr Bitboard BLACK_BACK_RANK = 0x0000000Fu;
+// Dwa ostatnie wiersze przed polem promocji
+constexpr Bitboard WHITE_RUNAWAY_ZONE = 0x00000FF0u;
+constexpr Bitboard BLACK_RUNAWAY_ZONE = 0x0FF00000u;
+
+constexpr int oppositeDirection(int dir) {
+    return NUM_DIRECTIONS - 1 - dir;
+}
+
+// Cechy jednej strony liczone dla calej planszy naraz: przesuniecia, maski i popcount.
+template<Color C>
+int sideFeatures(const Board& board, Bitboard empty) {
+    constexpr int LEFT = C == Color::WHITE ? UP_LEFT : DOWN_LEFT;
+    constexpr int RIGHT = C == Color::WHITE ? UP_RIGHT : DOWN_RIGHT;
+    constexpr Bitboard BACK_RANK = C == Color::WHITE ? WHITE_BACK_RANK : BLACK_BACK_RANK;
+    constexpr Bitboard RUNAWAY_ZONE = C == Color::WHITE ? WHITE_RUNAWAY_ZONE : BLACK_RUNAWAY_ZONE;
+    Bitboard pawns = board.pawns<C>();
+    Bitboard kings = board.kings<C>();
+
+    int mobility = popCount(shiftBoard<LEFT>(pawns) & empty) + popCount(shiftBoard<RIGHT>(pawns) & empty) +
+                   popCount(shiftBoard<UP_LEFT>(kings) & empty) + popCount(shiftBoard<UP_RIGHT>(kings) & empty) +
+                   popCount(shiftBoard<DOWN_LEFT>(kings) & empty) + popCount(shiftBoard<DOWN_RIGHT>(kings) & empty);
+
+    // Pionek z wolnym polem przed soba, przesuniecie pustych pol wstecz trafia w pionka
+    Bitboard freeStep = shiftBoard<oppositeDirection(LEFT)>(empty) | shiftBoard<oppositeDirection(RIGHT)>(empty);
+    int runaways = popCount(pawns & RUNAWAY_ZONE & freeStep);
+    int backRank = popCount(pawns & BACK_RANK);
+
+    return MOBILITY_WEIGHT * mobility + BACK_RANK_WEIGHT * backRank + RUNAWAY_WEIGHT * runaways;
+}
+
+// Bierki, ktore przeciwnik moze zbic pojedynczym skokiem: wrog na jednym
+// sasiednim polu i puste pole po przeciwnej stronie. Bicia damek z dystansu sa pomijane.
+template<Color C>
+Bitboard exposedPieces(const Board& board, Bitboard empty) {
+    Bitboard enemies = board.pieces<opponent(C)>();
+    Bitboard threatened = (shiftBoard<DOWN_RIGHT>(enemies) & shiftBoard<UP_LEFT>(empty)) |
+                          (shiftBoard<UP_LEFT>(enemies) & shiftBoard<DOWN_RIGHT>(empty)) |
+                          (shiftBoard<DOWN_LEFT>(enemies) & shiftBoard<UP_RIGHT>(empty)) |
+                          (shiftBoard<UP_RIGHT>(enemies) & shiftBoard<DOWN_LEFT>(empty));
+    return board.pieces<C>() & threatened;
+}
+
+
+template<Color C>
+int positionalScore(const Board& board) {
+    constexpr Color O = opponent(C);
+    Bitboard empty = ~board.occupied();
+
+    int score = sideFeatures<C>(board, empty) - sideFeatures<O>(board, empty);
+    score -= EXPOSED_WEIGHT * (popCount(exposedPieces<C>(board, empty)) - popCount(exposedPieces<O>(board, empty)));
+    return score + TEMPO_BONUS;
+}
+
+#ifndef NDEBUG
+// Te same cechy liczone pole po polu z tablic sasiadow; tylko do asercji
+// sprawdzajacej wersje na przesunieciach calej planszy.
+template<Color C>
+int bruteForceSideFeatures(const Board& board, Bitboard empty) {
+    constexpr int LEFT = C == Color::WHITE ? UP_LEFT : DOWN_LEFT;
+    constexpr Bitboard BACK_RANK = C == Color::WHITE ? WHITE_BACK_RANK : BLACK_BACK_RANK;
+    constexpr Bitboard RUNAWAY_ZONE = C == Color::WHITE ? WHITE_RUNAWAY_ZONE : BLACK_RUNAWAY_ZONE;
+    int score = 0;
+    for (int square = 0; square < NUM_SQUARES; square++) {
+        bool pawn = board.pawns<C>() & squareBit(square);
+        bool king = board.kings<C>() & squareBit(square);
+        bool freeStep = false;
+        for (int dir = 0; dir < NUM_DIRECTIONS; dir++) {
+            int target = neighborSquare(square, dir);
+            bool forward = dir == LEFT || dir == LEFT + 1;
+            if (target < 0 || !(empty & squareBit(target)) || (pawn && !forward) || (!pawn && !king)) {
+                continue;
+            }
+            score += MOBILITY_WEIGHT;
+            freeStep = freeStep || pawn;
+        }
+        if (pawn && (BACK_RANK & squareBit(square))) {
+            score += BACK_RANK_WEIGHT;
+        }
+        if (freeStep && (RUNAWAY_ZONE & squareBit(square))) {
+            score += RUNAWAY_WEIGHT;
+        }
+    }
+    return score;
+}
+
+template<Color C>
+int bruteForceExposed(const Board& board, Bitboard empty) {
+    int count = 0;
+    for (int square = 0; square < NUM_SQUARES; square++) {
+        if (!(board.pieces<C>() & squareBit(square))) {
+            continue;
+        }
+        for (int dir = 0; dir < NUM_DIRECTIONS; dir++) {
+            int attacker = neighborSquare(square, dir);
+            int landing = neighborSquare(square, oppositeDirection(dir));
+            if (attacker >= 0 && landing >= 0 && (board.pieces<opponent(C)>() & squareBit(attacker)) &&
+                (empty & squareBit(landing))) {
+                count++;
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+template<Color C>
+int bruteForcePositionalScore(const Board& board) {
+    constexpr Color O = opponent(C);
+    Bitboard empty = ~board.occupied();
+    int score = bruteForceSideFeatures<C>(board, empty) - bruteForceSideFeatures<O>(board, empty);
+    score -= EXPOSED_WEIGHT * (bruteForceExposed<C>(board, empty) - bruteForceExposed<O>(board, empty));
+    return score + TEMPO_BONUS;
+}
+#endif
+
+template<Color C>
+int materialScore(const Board& board) {
+    return C == Color::WHITE ? board.getPieceScore() : -board.getPieceScore();
+}
+}
+
+// Material i tablice pozycyjne sa aktualizowane w makeMove/unmakeMove,
+// pozostale cechy kosztuja kilkadziesiat instrukcji bez petli po polach.
+template<Color C>
+int evaluate(const Board& board, int lowerBound, int upperBound, EvalTier& tier) {
+    int material = materialScore<C>(board);
+    // Przy wczesnym wyjsciu zwracana jest granica, a nie sam material: w wersji
+    // fail-soft wynik jest przenoszony w gore drzewa i zapisywany w tablicy transpozycji
+    if (material + LAZY_EVAL_MARGIN <= lowerBound) {
+        tier = EvalTier::MATERIAL;
+        return material + LAZY_EVAL_MARGIN;
+    }
+    if (material - LAZY_EVAL_MARGIN >= upperBound) {
+        tier = EvalTier::MATERIAL;
+        return material - LAZY_EVAL_MARGIN;
+    }
+    tier = EvalTier::FULL;
+    int positional = positionalScore<C>(board);
+    assert(positional == bruteForcePositionalScore<C>(board));
+    return material + positional;
+}
+
+template int evaluate<Color::WHITE>(const Board& board, int lowerBound, int upperBound, EvalTier& tier);
+template int evaluate<Color::BLACK>(const Board& board, int lowerBound, int upperBound, EvalTier& tier);
@@ -0,0 +1,23 @@
+#ifndef EVALUATION_H
+#define EVALUATION_H
+
+#include "board.h"
+
+// Poziom, na ktorym zakonczyla sie leniwa ocena.
+enum class EvalTier {MATERIAL = 0, FULL = 1};
+
+// Heurystyczny margines roznicy miedzy pelna ocena a samym materialem.
+// Najwieksza roznica zmierzona na ok. 10 mln pozycji z losowych partii
+// wyniosla 35; scisle ograniczenie z wag (okolo 9 na bierke) wylaczaloby
+// leniwa ocene prawie w calej partii.
+const int LAZY_EVAL_MARGIN = 36;
+
+// Ocena statyczna pozycji z punktu widzenia strony C. Leniwa: gdy sam
+// material lezy dalej niz LAZY_EVAL_MARGIN poza przedzialem
+// (lowerBound, upperBound), cechy pozycyjne zakladamy za zbyt male, by
+// zmienic wynik, i zwracana jest granica material +/- LAZY_EVAL_MARGIN
+// od strony przedzialu. W tier zapisywany jest uzyty poziom.
+template<Color C>
+[[nodiscard]] int evaluate(const Board& board, int lowerBound, int upperBound, EvalTier& tier);
+
+#endif
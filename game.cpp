@@ -1,9 +1,9 @@
 #include "Game.h"
 #include <iostream>
 #include <algorithm>
-#include <climits>
 
-Game::Game() : playerTurn(true), rng(std::random_device{}()) {}
+Game::Game(const TimeControl& timeControl, const SearchLimits& limits)
+    : playerTurn(true), rng(std::random_device{}()), gameClock(timeControl), engine(limits) {}
 
 void Game::play() {
     displayInstructions();
@@ -22,6 +22,8 @@ void Game::play() {
             break;
         }
         
+        Color side = playerTurn ? Color::WHITE : Color::BLACK;
+        gameClock.startTurn(side);
         if (playerTurn) {
             std::cout << "\nTwoj ruch (biale pionki 'o'):\n";
             playerMove();
@@ -29,9 +31,20 @@ void Game::play() {
             std::cout << "\nRuch komputera (czarne pionki 'x')...\n";
             computerMove();
         }
+        gameClock.stopTurn(side);
+
+        if (gameClock.isFlagged(side)) {
+            std::cout << "\n=== KONIEC CZASU ===\n";
+            std::cout << (playerTurn ? "Komputer wygral\n" : "Wygrales!\n");
+            break;
+        }
         
         playerTurn = !playerTurn;
+        if (playerTurn) {
+            engine.startPondering(board);
+        }
     }
+    engine.stopPondering(Move(0, 0), 0);
 }
 
 void Game::displayInstructions() const {
@@ -40,6 +53,7 @@ void Game::displayInstructions() const {
     std::cout << "- Twoje pionki: 'o' (biale), damki: 'O'\n";
     std::cout << "- Pionki komputera: 'x' (czarne), damki: 'X'\n";
     std::cout << "- Bicie jest obowiazkowe\n";
+    std::cout << "- Bicie wielokrotne to jeden ruch - podaj pole koncowe\n";
     std::cout << "- Pionek staje sie damka na przeciwnej stronie\n";
     std::cout << "- Podaj wspolrzedne: wiersz kolumna (np. 5 2)\n";
     std::cout << "- Najpierw skad, potem dokad\n\n";
@@ -49,6 +63,10 @@ void Game::displayGameState() {
     board.displayBoard();
     std::cout << "Biale pionki 'o': " << board.countPieces(true)
               << " | Czarne pionki 'x': " << board.countPieces(false) << "\n";
+    if (gameClock.usesClock()) {
+        std::cout << "Zegar - Ty: " << GameClock::format(gameClock.remaining(Color::WHITE))
+                  << " | Komputer: " << GameClock::format(gameClock.remaining(Color::BLACK)) << "\n";
+    }
 }
 
 void Game::playerMove() {
@@ -60,8 +78,9 @@ void Game::playerMove() {
             continue;
         }
         
-        Move validMove(from, to);
+        Move validMove;
         if (isValidPlayerMove(from, to, validMove)) {
+            engine.stopPondering(validMove, gameClock.moveBudgetMs(Color::BLACK));
             board.makeMove(validMove);
             std::cout << "Ruch wykonany: (" << from.row << "," << from.col 
                       << ") -> (" << to.row << "," << to.col << ")\n";
@@ -91,122 +110,55 @@ bool Game::getPlayerInput(Position& from, Position& to) {
 }
 
 bool Game::isValidPlayerMove(const Position& from, const Position& to, Move& validMove) {
-    std::vector<Move> possibleMoves = board.getAllMoves(true);
+    MoveList possibleMoves = board.getAllMoves(true);
+    std::vector<Move> matches;
     
     for (const Move& move : possibleMoves) {
-        if (move.from == from && move.to == to) {
-            validMove = move;
-            return true;
+        if (move.fromPosition() == from && move.toPosition() == to) {
+            matches.push_back(move);
         }
     }
     
-    return false;
-}
-
-void Game::computerMove() {
-    Move bestMove = getBestComputerMove();
-    board.makeMove(bestMove);
-    std::cout << "Komputer: (" << bestMove.from.row << "," << bestMove.from.col 
-              << ") -> (" << bestMove.to.row << "," << bestMove.to.col << ")\n";
-}
-
-Move Game::getBestComputerMove() {
-    std::vector<Move> possibleMoves = board.getAllMoves(false);
-    
-    if (possibleMoves.empty()) {
-        return Move(Position(), Position());
-    }
-    
-    Move bestMove = possibleMoves[0];
-    int bestScore = INT_MIN;
-    
-    for (const Move& move : possibleMoves) {
-        Board tempBoard = board;
-        tempBoard.makeMove(move);
-        
-        int score = minimax(tempBoard, 3, false);
-        
-        if (score > bestScore) {
-            bestScore = score;
-            bestMove = move;
+    if (matches.size() > 1) {
+        // Rozne lancuchy bic moga miec wspolny poczatek i koniec
+        std::cout << "Kilka bic konczy sie na tym polu:\n";
+        for (size_t i = 0; i < matches.size(); i++) {
+            std::cout << i + 1 << ". bite pionki:";
+            Bitboard captured = matches[i].captured;
+            while (captured) {
+                int square = popLowestSquare(captured);
+                std::cout << " (" << squareRow(square) << "," << squareCol(square) << ")";
+            }
+            std::cout << "\n";
         }
-    }
-    
-    return bestMove;
-}
-
-int Game::minimax(Board tempBoard, int depth, bool maximizing) const {
-    bool whiteWins;
-    if (depth == 0 || tempBoard.isGameOver(whiteWins)) {
-        if (tempBoard.isGameOver(whiteWins)) {
-            return whiteWins ? -1000 : 1000;
+        std::cout << "Wybierz bicie (numer): ";
+        int choice;
+        if (!(std::cin >> choice) || choice < 1 || choice > static_cast<int>(matches.size())) {
+            std::cin.clear();
+            std::cin.ignore(10000, '\n');
+            return false;
         }
-        return evaluateBoard();
+        validMove = matches[choice - 1];
+        return true;
     }
     
-    if (maximizing) {
-        int maxEval = INT_MIN;
-        std::vector<Move> moves = tempBoard.getAllMoves(false);
-        
-        for (const Move& move : moves) {
-            Board newBoard = tempBoard;
-            newBoard.makeMove(move);
-            int eval = minimax(newBoard, depth - 1, false);
-            maxEval = std::max(maxEval, eval);
-        }
-        
-        return maxEval;
-    } else {
-        int minEval = INT_MAX;
-        std::vector<Move> moves = tempBoard.getAllMoves(true);
-        
-        for (const Move& move : moves) {
-            Board newBoard = tempBoard;
-            newBoard.makeMove(move);
-            int eval = minimax(newBoard, depth - 1, true);
-            minEval = std::min(minEval, eval);
-        }
-        
-        return minEval;
+    if (matches.size() == 1) {
+        validMove = matches[0];
+        return true;
     }
+    return false;
 }
 
-int Game::evaluateBoard() const {
-    int score = 0;
-    
-    for (int row = 0; row < 8; row++) {
-        for (int col = 0; col < 8; col++) {
-            PieceType piece = board.getPiece(row, col);
-            
-            switch (piece) {
-                case PieceType::BLACK_PAWN:
-                    score += 10;
-                    break;
-                case PieceType::BLACK_KING:
-                    score += 30;
-                    break;
-                case PieceType::WHITE_PAWN:
-                    score -= 10;
-                    break;
-                case PieceType::WHITE_KING:
-                    score -= 30;
-                    break;
-                default:
-                    break;
-            }
-        }
-    }
-
-    for (int row = 2; row < 6; row++) {
-        for (int col = 2; col < 6; col++) {
-            PieceType piece = board.getPiece(row, col);
-            if (piece == PieceType::BLACK_PAWN || piece == PieceType::BLACK_KING) {
-                score += 2;
-            } else if (piece == PieceType::WHITE_PAWN || piece == PieceType::WHITE_KING) {
-                score -= 2;
-            }
-        }
-    }
-    
-    return score;
-}
\ No newline at end of file
+void Game::computerMove() {
+    std::future<Move> ponderedSearch = engine.takePonderedSearch();
+    bool ponderHit = ponderedSearch.valid();
+    Move bestMove = ponderHit ? ponderedSearch.get()
+                              : engine.search(board, gameClock.moveBudgetMs(Color::BLACK));
+    board.makeMove(bestMove);
+    Position from = bestMove.fromPosition();
+    Position to = bestMove.toPosition();
+    std::cout << "Komputer: (" << from.row << "," << from.col 
+              << ") -> (" << to.row << "," << to.col << ")\n";
+    engine.printStats(std::cout);
+    std::cout << (ponderHit ? " | Ruch przemyslany w czasie ruchu gracza" : "") << "\n";
+}
@@ -2,6 +2,8 @@
 #define GAME_H
 
 #include "Board.h"
+#include "searchEngine.h"
+#include "timeManager.h"
 #include <random>
 
 class Game {
@@ -9,19 +11,18 @@ private:
     Board board;
     bool playerTurn; // true = gracz (białe), false = komputer (czarne)
     std::mt19937 rng;
+    GameClock gameClock;
+    SearchEngine engine;
 
 public:
-    Game();
+    explicit Game(const TimeControl& timeControl = TimeControl(), const SearchLimits& limits = SearchLimits());
     void play();
     void playerMove();
     void computerMove();
     bool getPlayerInput(Position& from, Position& to);
     void displayGameState();
     bool isValidPlayerMove(const Position& from, const Position& to, Move& validMove);
-    Move getBestComputerMove();
-    [[nodiscard]] int evaluateBoard() const;
-    [[nodiscard]] int minimax(Board tempBoard, int depth, bool maximizing) const;
     void displayInstructions() const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -1,13 +1,15 @@
 #include "GraphicalGame.h"
 #include <iostream>
 #include <algorithm>
+#include <chrono>
 #include <climits>
 #include <sstream>
 
-GraphicalGame::GraphicalGame() 
-    : playerTurn(true), rng(std::random_device{}()), 
-      selectedPiece(-1, -1), pieceSelected(false), gameRunning(true), showInstructions(true),
-      window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Warcaby - Graficzna wersja") {
+GraphicalGame::GraphicalGame(const TimeControl& timeControl, const SearchLimits& limits) 
+    : playerTurn(true), rng(std::random_device{}()), gameClock(timeControl), engine(limits),
+      computerPondered(false), window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Warcaby - Graficzna wersja"),
+      selectedPiece(-1, -1), pieceSelected(false), chosenCaptures(0), gameRunning(true), showInstructions(true),
+      whiteWins(false) {
     
 
     LIGHT_SQUARE_COLOR = sf::Color(240, 217, 181);
@@ -32,6 +34,8 @@ void GraphicalGame::run() {
         update();
         render();
     }
+    cancelComputerMove();
+    engine.stopPondering(Move(0, 0), 0);
 }
 
 bool GraphicalGame::initializeGraphics() {
@@ -47,6 +51,8 @@ void GraphicalGame::handleEvents() {
     while (window.pollEvent(event)) {
         switch (event.type) {
             case sf::Event::Closed:
+                cancelComputerMove();
+                engine.stopPondering(Move(0, 0), 0);
                 window.close();
                 break;
                 
@@ -62,10 +68,14 @@ void GraphicalGame::handleEvents() {
                 
             case sf::Event::KeyPressed:
                 if (event.key.code == sf::Keyboard::R) {
-                    // Restart gry
+                    // Restart gry - najpierw zatrzymujemy wyszukiwanie, ktore czyta plansze
+                    cancelComputerMove();
+                    engine.stopPondering(Move(0, 0), 0);
                     board = Board();
                     playerTurn = true;
                     gameRunning = true;
+                    whiteWins = false;
+                    gameClock.reset();
                     resetSelection();
                 }
                 if (event.key.code == sf::Keyboard::H) {
@@ -90,6 +100,11 @@ void GraphicalGame::handleMouseClick(int mouseX, int mouseY) {
     if (!board.isDarkSquare(clickedSquare.row, clickedSquare.col)) {
         return;
     }
+
+    if (!captureChoices.empty()) {
+        chooseCapture(clickedSquare);
+        return;
+    }
     
     if (!pieceSelected) {
         PieceType piece = board.getPiece(clickedSquare.row, clickedSquare.col);
@@ -98,7 +113,12 @@ void GraphicalGame::handleMouseClick(int mouseX, int mouseY) {
         }
     } else {
         if (clickedSquare == selectedPiece) {
-            resetSelection();
+            // Klikniecie na wybrany pionek konczy bicie wracajace na pole startowe
+            if (isPossibleMove(clickedSquare)) {
+                makePlayerMove(clickedSquare);
+            } else {
+                resetSelection();
+            }
         } else {
             PieceType piece = board.getPiece(clickedSquare.row, clickedSquare.col);
             if (piece == PieceType::WHITE_PAWN || piece == PieceType::WHITE_KING) {
@@ -129,26 +149,76 @@ void GraphicalGame::selectPiece(const Position& pos) {
 }
 
 void GraphicalGame::makePlayerMove(const Position& to) {
-    Move validMove(selectedPiece, to);
-    if (isValidPlayerMove(selectedPiece, to, validMove)) {
-        board.makeMove(validMove);
-        playerTurn = false;
+    std::vector<Move> candidates;
+    for (const Move& move : possibleMoves) {
+        if (move.toPosition() == to) {
+            candidates.push_back(move);
+        }
+    }
+
+    if (candidates.size() == 1) {
+        playPlayerMove(candidates[0]);
+    } else if (candidates.size() > 1) {
+        // Kilka lancuchow bic o tym samym celu - gracz wskazuje bite pionki
+        captureChoices = candidates;
+        chosenCaptures = 0;
+    }
+}
+
+// Klikniecie bitego pionka zaweza wybor do lancuchow, ktore go bija. Ponowne
+// klikniecie celu wybiera lancuch bijacy dokladnie wskazane pionki.
+void GraphicalGame::chooseCapture(const Position& pos) {
+    if (pos == captureChoices[0].toPosition()) {
+        for (const Move& move : captureChoices) {
+            if (move.captured == chosenCaptures) {
+                playPlayerMove(move);
+                return;
+            }
+        }
+        return;
+    }
+
+    Bitboard bit = squareBit(squareIndex(pos.row, pos.col));
+    std::vector<Move> remaining;
+    for (const Move& move : captureChoices) {
+        if (move.captured & bit) {
+            remaining.push_back(move);
+        }
+    }
+
+    if (remaining.empty()) {
         resetSelection();
+        return;
+    }
+    chosenCaptures |= bit;
+    captureChoices = remaining;
+    if (captureChoices.size() == 1) {
+        playPlayerMove(captureChoices[0]);
     }
 }
 
+void GraphicalGame::playPlayerMove(const Move& move) {
+    engine.stopPondering(move, gameClock.moveBudgetMs(Color::BLACK));
+    board.makeMove(move);
+    gameClock.stopTurn(Color::WHITE);
+    playerTurn = false;
+    resetSelection();
+}
+
 void GraphicalGame::resetSelection() {
     pieceSelected = false;
     selectedPiece = Position(-1, -1);
     possibleMoves.clear();
+    captureChoices.clear();
+    chosenCaptures = 0;
 }
 
 void GraphicalGame::updatePossibleMoves() {
     possibleMoves.clear();
     if (pieceSelected) {
-        std::vector<Move> allMoves = board.getAllMoves(true);
+        MoveList allMoves = board.getAllMoves(true);
         for (const Move& move : allMoves) {
-            if (move.from == selectedPiece) {
+            if (move.fromPosition() == selectedPiece) {
                 possibleMoves.push_back(move);
             }
         }
@@ -157,147 +227,70 @@ void GraphicalGame::updatePossibleMoves() {
 
 bool GraphicalGame::isPossibleMove(const Position& pos) const {
     for (const Move& move : possibleMoves) {
-        if (move.to == pos) {
+        if (move.toPosition() == pos) {
             return true;
         }
     }
     return false;
 }
 
-bool GraphicalGame::isValidPlayerMove(const Position& from, const Position& to, Move& validMove) {
-    std::vector<Move> allMoves = board.getAllMoves(true);
-    
-    for (const Move& move : allMoves) {
-        if (move.from == from && move.to == to) {
-            validMove = move;
-            return true;
-        }
-    }
-    
-    return false;
-}
-
 void GraphicalGame::update() {
     if (!gameRunning) return;
 
-    bool whiteWins;
     if (board.isGameOver(whiteWins)) {
+        engine.stopPondering(Move(0, 0), 0);
         gameRunning = false;
         return;
     }
 
-    if (!playerTurn && gameRunning) {
-        computerMove();
-        playerTurn = true;
+    if (gameClock.isFlagged(Color::WHITE) || gameClock.isFlagged(Color::BLACK)) {
+        cancelComputerMove();
+        engine.stopPondering(Move(0, 0), 0);
+        whiteWins = gameClock.isFlagged(Color::BLACK);
+        gameRunning = false;
+        return;
     }
-}
 
-void GraphicalGame::computerMove() {
-    Move bestMove = getBestComputerMove();
-    if (bestMove.from.row != -1) {
-        board.makeMove(bestMove);
+    if (playerTurn) {
+        if (!showInstructions && !gameClock.isRunning()) {
+            gameClock.startTurn(Color::WHITE);
+        }
+    } else if (!computerResult.valid()) {
+        gameClock.startTurn(Color::BLACK);
+        computerResult = engine.takePonderedSearch();
+        computerPondered = computerResult.valid();
+        if (!computerPondered) {
+            startComputerMove();
+        }
+    } else if (computerResult.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        finishComputerMove(computerResult.get(), computerPondered);
     }
 }
 
-Move GraphicalGame::getBestComputerMove() {
-    std::vector<Move> possibleMoves = board.getAllMoves(false);
-    
-    if (possibleMoves.empty()) {
-        return Move(Position(-1, -1), Position(-1, -1));
-    }
-    
-    Move bestMove = possibleMoves[0];
-    int bestScore = INT_MIN;
-    
-    for (const Move& move : possibleMoves) {
-        Board tempBoard = board;
-        tempBoard.makeMove(move);
-        
-        int score = minimax(tempBoard, 3, false);
-        
-        if (score > bestScore) {
-            bestScore = score;
-            bestMove = move;
-        }
-    }
-    
-    return bestMove;
+// Wyszukiwanie dziala w osobnym watku, a petla okna dalej obsluguje zdarzenia
+// i rysuje. Plansza jest zmieniana tylko w watku okna, gdy wynik jest gotowy.
+void GraphicalGame::startComputerMove() {
+    computerResult = engine.searchAsync(board, gameClock.moveBudgetMs(Color::BLACK));
 }
 
-int GraphicalGame::minimax(Board tempBoard, int depth, bool maximizing) const {
-    bool whiteWins;
-    if (depth == 0 || tempBoard.isGameOver(whiteWins)) {
-        if (tempBoard.isGameOver(whiteWins)) {
-            return whiteWins ? -1000 : 1000;
-        }
-        return evaluateBoard();
-    }
-    
-    if (maximizing) {
-        int maxEval = INT_MIN;
-        std::vector<Move> moves = tempBoard.getAllMoves(false);
-        
-        for (const Move& move : moves) {
-            Board newBoard = tempBoard;
-            newBoard.makeMove(move);
-            int eval = minimax(newBoard, depth - 1, false);
-            maxEval = std::max(maxEval, eval);
-        }
-        
-        return maxEval;
-    } else {
-        int minEval = INT_MAX;
-        std::vector<Move> moves = tempBoard.getAllMoves(true);
-        
-        for (const Move& move : moves) {
-            Board newBoard = tempBoard;
-            newBoard.makeMove(move);
-            int eval = minimax(newBoard, depth - 1, true);
-            minEval = std::min(minEval, eval);
-        }
-        
-        return minEval;
+void GraphicalGame::cancelComputerMove() {
+    if (!computerResult.valid()) {
+        return;
     }
+    engine.cancel(computerResult);
+    gameClock.stopTurn(Color::BLACK);
 }
 
-int GraphicalGame::evaluateBoard() const {
-    int score = 0;
-    
-    for (int row = 0; row < 8; row++) {
-        for (int col = 0; col < 8; col++) {
-            PieceType piece = board.getPiece(row, col);
-            
-            switch (piece) {
-                case PieceType::BLACK_PAWN:
-                    score += 10;
-                    break;
-                case PieceType::BLACK_KING:
-                    score += 30;
-                    break;
-                case PieceType::WHITE_PAWN:
-                    score -= 10;
-                    break;
-                case PieceType::WHITE_KING:
-                    score -= 30;
-                    break;
-                default:
-                    break;
-            }
-        }
+void GraphicalGame::finishComputerMove(const Move& bestMove, bool ponderHit) {
+    if (!bestMove.isNull()) {
+        board.makeMove(bestMove);
     }
+    gameClock.stopTurn(Color::BLACK);
+    playerTurn = true;
 
-    for (int row = 2; row < 6; row++) {
-        for (int col = 2; col < 6; col++) {
-            PieceType piece = board.getPiece(row, col);
-            if (piece == PieceType::BLACK_PAWN || piece == PieceType::BLACK_KING) {
-                score += 2;
-            } else if (piece == PieceType::WHITE_PAWN || piece == PieceType::WHITE_KING) {
-                score -= 2;
-            }
-        }
-    }
-    
-    return score;
+    engine.printStats(std::cout);
+    std::cout << (ponderHit ? " | Ruch przemyslany w czasie ruchu gracza" : "") << std::endl;
+    engine.startPondering(board);
 }
 
 void GraphicalGame::render() {
@@ -312,8 +305,6 @@ void GraphicalGame::render() {
         drawUI();
         
         if (!gameRunning) {
-            bool whiteWins;
-            board.isGameOver(whiteWins);
             drawGameOverScreen(whiteWins);
         }
     }
@@ -350,11 +341,24 @@ void GraphicalGame::drawHighlights() {
 
     for (const Move& move : possibleMoves) {
         sf::RectangleShape highlight(sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE));
-        highlight.setPosition(BOARD_OFFSET_X + move.to.col * SQUARE_SIZE,
-                            BOARD_OFFSET_Y + move.to.row * SQUARE_SIZE);
+        Position target = move.toPosition();
+        highlight.setPosition(BOARD_OFFSET_X + target.col * SQUARE_SIZE,
+                            BOARD_OFFSET_Y + target.row * SQUARE_SIZE);
         highlight.setFillColor(POSSIBLE_MOVE_COLOR);
         window.draw(highlight);
     }
+
+    for (const Move& move : captureChoices) {
+        Bitboard captured = move.captured;
+        while (captured) {
+            int square = popLowestSquare(captured);
+            sf::RectangleShape highlight(sf::Vector2f(SQUARE_SIZE, SQUARE_SIZE));
+            highlight.setPosition(BOARD_OFFSET_X + squareCol(square) * SQUARE_SIZE,
+                                BOARD_OFFSET_Y + squareRow(square) * SQUARE_SIZE);
+            highlight.setFillColor((chosenCaptures & squareBit(square)) ? SELECTED_COLOR : HIGHLIGHT_COLOR);
+            window.draw(highlight);
+        }
+    }
 }
 
 void GraphicalGame::drawPieces() {
@@ -409,7 +413,11 @@ void GraphicalGame::drawUI() {
                         " | Czarne: " + std::to_string(board.countPieces(false));
     
     if (gameRunning) {
-        status += " | Tura: " + std::string(playerTurn ? "Gracza" : "Komputera");
+        status += " | Tura: " + std::string(playerTurn ? "Gracza" : "Komputera (mysli...)");
+    }
+    if (gameClock.usesClock()) {
+        status += " | Ty " + GameClock::format(gameClock.remaining(Color::WHITE)) +
+                  " | Komputer " + GameClock::format(gameClock.remaining(Color::BLACK));
     }
     
     statusText.setString(status);
@@ -420,7 +428,8 @@ void GraphicalGame::drawUI() {
     helpText.setCharacterSize(16);
     helpText.setFillColor(sf::Color::White);
     helpText.setPosition(10, WINDOW_HEIGHT - 40);
-    helpText.setString("R - Reset | H - Pomoc | Kliknij pionek, potem cel");
+    helpText.setString(captureChoices.empty() ? "R - Reset | H - Pomoc | Kliknij pionek, potem cel"
+                                              : "Kilka bic do tego pola - kliknij bity pionek (zolty)");
     window.draw(helpText);
 }
 
@@ -449,6 +458,8 @@ void GraphicalGame::drawInstructions() {
         "- Pionki komputera: czarne (x), damki ze zlotym kolkiem\n"
         "- Poruszasz sie tylko po ciemnych polach\n"
         "- Bicie jest obowiazkowe gdy jest mozliwe\n"
+        "- Bicie wielokrotne to jeden ruch - kliknij pole koncowe\n"
+        "- Gdy kilka bic konczy sie na tym polu, kliknij bite pionki\n"
         "- Pionek staje sie damka na przeciwnej stronie planszy\n"
         "- Damki moga poruszac sie we wszystkich kierunkach\n\n"
         "STEROWANIE:\n\n"
@@ -2,7 +2,10 @@
 #define GRAPHICALGAME_H
 
 #include "Board.h"
+#include "searchEngine.h"
+#include "timeManager.h"
 #include <SFML/Graphics.hpp>
+#include <future>
 #include <random>
 
 class GraphicalGame {
@@ -10,6 +13,10 @@ private:
     Board board;
     bool playerTurn;
     std::mt19937 rng;
+    GameClock gameClock;
+    SearchEngine engine;
+    std::future<Move> computerResult;
+    bool computerPondered; // computerResult to kontynuacja myslenia w czasie ruchu gracza
     
     sf::RenderWindow window;
     sf::Font font;
@@ -33,11 +40,15 @@ private:
     Position selectedPiece;
     bool pieceSelected;
     std::vector<Move> possibleMoves;
+    std::vector<Move> captureChoices; // bicia o wspolnym polu startowym i koncowym
+    Bitboard chosenCaptures;
     bool gameRunning;
     bool showInstructions;
+    bool whiteWins;
     
 public:
-    GraphicalGame();
+    explicit GraphicalGame(const TimeControl& timeControl = TimeControl(),
+                           const SearchLimits& limits = SearchLimits());
     void run();
     
 private:
@@ -59,12 +70,12 @@ private:
 
     void selectPiece(const Position& pos);
     void makePlayerMove(const Position& to);
-    void computerMove();
-    Move getBestComputerMove();
-    int evaluateBoard() const;
-    int minimax(Board tempBoard, int depth, bool maximizing) const;
+    void chooseCapture(const Position& pos);
+    void playPlayerMove(const Move& move);
+    void startComputerMove();
+    void cancelComputerMove();
+    void finishComputerMove(const Move& bestMove, bool ponderHit);
 
-    bool isValidPlayerMove(const Position& from, const Position& to, Move& validMove);
     void updatePossibleMoves();
 
     void resetSelection();
@@ -1,23 +1,88 @@
 #include "game.h"
 #include "GraphicalGame.h"
+#include "perft.h"
+#include "searchBenchmark.h"
 #include <iostream>
+#include <string>
+
+// Wagi sieci oceny szukane w katalogu roboczym; bez pliku gra uzywa recznej oceny
+const std::string NETWORK_FILE = "warcaby.nnue";
+
+TimeControl readTimeControl() {
+    TimeControl timeControl;
+    int mode;
+    std::cout << "Czas komputera: 1. Staly czas na ruch  2. Zegar z dodatkiem (Fischer)\n";
+    std::cin >> mode;
+
+    if (mode == 2) {
+        int baseSeconds, incrementSeconds;
+        std::cout << "Czas bazowy (s): ";
+        std::cin >> baseSeconds;
+        std::cout << "Dodatek za ruch (s): ";
+        std::cin >> incrementSeconds;
+        timeControl.moveTimeMs = 0;
+        timeControl.baseTimeMs = baseSeconds * 1000;
+        timeControl.incrementMs = incrementSeconds * 1000;
+    } else {
+        std::cout << "Czas na ruch (ms): ";
+        std::cin >> timeControl.moveTimeMs;
+    }
+    return timeControl;
+}
+
+SearchLimits readSearchLimits() {
+    SearchLimits limits;
+    limits.networkFile = NETWORK_FILE;
+    std::cout << "Liczba watkow komputera: ";
+    std::cin >> limits.threads;
+
+    if (limits.threads > 1) {
+        int mode;
+        std::cout << "Tryb wielowatkowy: 1. Lazy SMP  2. Podzial wezlow (YBWC)\n";
+        std::cin >> mode;
+        limits.parallelMode = mode == 2 ? ParallelMode::YBWC : ParallelMode::LAZY_SMP;
+    }
+    return limits;
+}
 
 int main() {
     std::cout << "=== WARCABY ===\n";
     std::cout << "Wybierz wersje gry:\n";
     std::cout << "1. Wersja konsolowa\n";
     std::cout << "2. Wersja graficzna (SFML)\n";
+    std::cout << "3. Test generatora ruchow (perft)\n";
+    std::cout << "4. Test skalowania wyszukiwania (1/8/16/32 watki)\n";
 
     int choice;
     std::cin >> choice;
 
     if (choice == 1) {
-        Game game;
+        TimeControl timeControl = readTimeControl();
+        Game game(timeControl, readSearchLimits());
         game.play();
     } else if (choice == 2) {
 
-        GraphicalGame graphicalGame;
+        TimeControl timeControl = readTimeControl();
+        GraphicalGame graphicalGame(timeControl, readSearchLimits());
         graphicalGame.run();
+    } else if (choice == 3) {
+        int depth, threads;
+        std::cout << "Glebokosc: ";
+        std::cin >> depth;
+        std::cout << "Liczba watkow: ";
+        std::cin >> threads;
+
+        Perft perft(threads);
+        Perft::printResult(perft.run(Board(), depth), true);
+    } else if (choice == 4) {
+        int depth, mode;
+        std::cout << "Glebokosc: ";
+        std::cin >> depth;
+        std::cout << "Tryb: 1. Lazy SMP  2. Podzial wezlow (YBWC)\n";
+        std::cin >> mode;
+
+        SearchBenchmark benchmark(depth, mode == 2 ? ParallelMode::YBWC : ParallelMode::LAZY_SMP);
+        SearchBenchmark::printResults(benchmark.run({1, 8, 16, 32}));
     } else {
         std::cout << "Nieprawidlowy wybor.\n";
     }
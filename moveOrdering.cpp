@@ -0,0 +1,80 @@
+#include "moveOrdering.h"
+#include <utility>
+
+namespace {
+const int HASH_MOVE_SCORE = 1000000;
+const int CAPTURE_SCORE = 500000;
+const int FIRST_KILLER_SCORE = 400000;
+const int SECOND_KILLER_SCORE = 300000;
+const int HISTORY_LIMIT = 200000;
+}
+
+MoveOrdering::MoveOrdering() : killers{}, history{} {}
+
+void MoveOrdering::newSearch() {
+    for (auto& plyKillers : killers) {
+        plyKillers[0] = Move(0, 0);
+        plyKillers[1] = Move(0, 0);
+    }
+    for (auto& from : history) {
+        for (int& score : from) {
+            score /= 2;
+        }
+    }
+}
+
+void MoveOrdering::recordCutoff(const Move& move, int ply, int depth) {
+    if (ply < MAX_PLY && !(killers[ply][0] == move)) {
+        killers[ply][1] = killers[ply][0];
+        killers[ply][0] = move;
+    }
+
+    int& score = history[move.from][move.to];
+    score += depth * depth;
+    if (score > HISTORY_LIMIT) {
+        for (auto& from : history) {
+            for (int& entry : from) {
+                entry /= 2;
+            }
+        }
+    }
+}
+
+int MoveOrdering::scoreMove(const Move& move, const Move& hashMove, int ply) const {
+    if (move == hashMove) {
+        return HASH_MOVE_SCORE;
+    }
+    if (move.isCapture()) {
+        return CAPTURE_SCORE + popCount(move.captured);
+    }
+    if (ply < MAX_PLY) {
+        if (move == killers[ply][0]) return FIRST_KILLER_SCORE;
+        if (move == killers[ply][1]) return SECOND_KILLER_SCORE;
+    }
+    return history[move.from][move.to];
+}
+
+MovePicker::MovePicker(MoveList& moves, const Move& hashMove, int ply, const MoveOrdering& ordering)
+    : moves(moves), current(0) {
+    for (int i = 0; i < moves.size(); i++) {
+        scores[i] = ordering.scoreMove(moves[i], hashMove, ply);
+    }
+}
+
+bool MovePicker::next(Move& move) {
+    if (current >= moves.size()) {
+        return false;
+    }
+
+    int best = current;
+    for (int i = current + 1; i < moves.size(); i++) {
+        if (scores[i] > scores[best]) {
+            best = i;
+        }
+    }
+    std::swap(moves[current], moves[best]);
+    std::swap(scores[current], scores[best]);
+
+    move = moves[current++];
+    return true;
+}
@@ -0,0 +1,34 @@
+#ifndef MOVEORDERING_H
+#define MOVEORDERING_H
+
+#include "board.h"
+
+// Ruchy zabijajace (dwa na poziom) i tablica historii dla ruchow bez bicia.
+class MoveOrdering {
+private:
+    static const int MAX_PLY = 64;
+    Move killers[MAX_PLY][2];
+    int history[NUM_SQUARES][NUM_SQUARES];
+
+public:
+    MoveOrdering();
+    void newSearch();
+    void recordCutoff(const Move& move, int ply, int depth);
+    [[nodiscard]] int scoreMove(const Move& move, const Move& hashMove, int ply) const;
+};
+
+// Wybiera ruchy leniwie: kolejny najlepszy ruch jest szukany dopiero wtedy,
+// gdy poprzedni nie dal odciecia.
+class MovePicker {
+private:
+    MoveList& moves;
+    int scores[MoveList::CAPACITY];
+    int current;
+
+public:
+    MovePicker(MoveList& moves, const Move& hashMove, int ply, const MoveOrdering& ordering);
+    bool next(Move& move);
+    [[nodiscard]] int movesPicked() const { return current; }
+};
+
+#endif
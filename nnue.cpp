@@ -0,0 +1,207 @@
+#include "nnue.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+const uint32_t NNUE_MAGIC = 0x314E4E57; // "WNN1"
+const int ACTIVATION_MAX = 127;
+// Wagi warstwy ukrytej maja skale 64, wyjscie sieci skale 16 na punkt oceny
+const int HIDDEN_SHIFT = 6;
+const int OUTPUT_SCALE = 16;
+
+template<typename T>
+bool readArray(std::ifstream& in, T* data, size_t count) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(count * sizeof(T))));
+}
+
+int pieceIndex(PieceType piece) {
+    return static_cast<int>(piece) - 1;
+}
+
+// values = source + added - removed dla jednego wiersza akumulatora; removed lub
+// added moga byc nullptr, source moze byc rowne values. Arytmetyka int16 modulo.
+void updateValues(int16_t* values, const int16_t* source, const int16_t* added, const int16_t* removed) {
+#if defined(__AVX2__)
+    for (int i = 0; i < NNUE_HIDDEN; i += 16) {
+        __m256i sum = _mm256_load_si256(reinterpret_cast<const __m256i*>(source + i));
+        if (added) sum = _mm256_add_epi16(sum, _mm256_load_si256(reinterpret_cast<const __m256i*>(added + i)));
+        if (removed) sum = _mm256_sub_epi16(sum, _mm256_load_si256(reinterpret_cast<const __m256i*>(removed + i)));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(values + i), sum);
+    }
+#elif defined(__SSE2__)
+    for (int i = 0; i < NNUE_HIDDEN; i += 8) {
+        __m128i sum = _mm_load_si128(reinterpret_cast<const __m128i*>(source + i));
+        if (added) sum = _mm_add_epi16(sum, _mm_load_si128(reinterpret_cast<const __m128i*>(added + i)));
+        if (removed) sum = _mm_sub_epi16(sum, _mm_load_si128(reinterpret_cast<const __m128i*>(removed + i)));
+        _mm_store_si128(reinterpret_cast<__m128i*>(values + i), sum);
+    }
+#else
+    for (int i = 0; i < NNUE_HIDDEN; i++) {
+        values[i] = static_cast<int16_t>(source[i] + (added ? added[i] : 0) - (removed ? removed[i] : 0));
+    }
+#endif
+}
+
+// Obciecie akumulatora do [0, 127] i zapis jako uint8.
+void clippedActivation(const int16_t* input, uint8_t* output) {
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i limit = _mm256_set1_epi16(ACTIVATION_MAX);
+    for (int i = 0; i < NNUE_HIDDEN; i += 32) {
+        __m256i low = _mm256_load_si256(reinterpret_cast<const __m256i*>(input + i));
+        __m256i high = _mm256_load_si256(reinterpret_cast<const __m256i*>(input + i + 16));
+        low = _mm256_min_epi16(_mm256_max_epi16(low, zero), limit);
+        high = _mm256_min_epi16(_mm256_max_epi16(high, zero), limit);
+        // packus przeplata polowki rejestrow, permutacja przywraca kolejnosc
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), packed);
+    }
+#elif defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i limit = _mm_set1_epi16(ACTIVATION_MAX);
+    for (int i = 0; i < NNUE_HIDDEN; i += 16) {
+        __m128i low = _mm_load_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i high = _mm_load_si128(reinterpret_cast<const __m128i*>(input + i + 8));
+        low = _mm_min_epi16(_mm_max_epi16(low, zero), limit);
+        high = _mm_min_epi16(_mm_max_epi16(high, zero), limit);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(low, high));
+    }
+#else
+    for (int i = 0; i < NNUE_HIDDEN; i++) {
+        output[i] = static_cast<uint8_t>(std::clamp<int>(input[i], 0, ACTIVATION_MAX));
+    }
+#endif
+}
+
+// Iloczyn skalarny aktywacji uint8 i wag int8; size jest wielokrotnoscia 32.
+// Pary iloczynow mieszcza sie w int16, bo aktywacje sa ograniczone do 127.
+int32_t dotProduct(const uint8_t* input, const int8_t* weights, int size) {
+#if defined(__AVX2__)
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i sum = _mm256_setzero_si256();
+    for (int i = 0; i < size; i += 32) {
+        __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(in, w), ones));
+    }
+    __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+    return _mm_cvtsi128_si32(half);
+#elif defined(__SSSE3__)
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i sum = _mm_setzero_si128();
+    for (int i = 0; i < size; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i));
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_maddubs_epi16(in, w), ones));
+    }
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+    return _mm_cvtsi128_si32(sum);
+#else
+    int32_t sum = 0;
+    for (int i = 0; i < size; i++) {
+        sum += input[i] * weights[i];
+    }
+    return sum;
+#endif
+}
+}
+
+// Format pliku: naglowek (magic, wejscia, warstwa ukryta, warstwa gesta jako
+// uint32), potem tablice w kolejnosci pol klasy, little-endian.
+bool NnueNetwork::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    uint32_t header[4];
+    if (!readArray(in, header, 4) || header[0] != NNUE_MAGIC || header[1] != NNUE_INPUTS ||
+        header[2] != NNUE_HIDDEN || header[3] != NNUE_DENSE) {
+        return false;
+    }
+
+    bool complete = readArray(in, &featureWeights[0][0], NNUE_INPUTS * NNUE_HIDDEN) &&
+                    readArray(in, featureBias, NNUE_HIDDEN) &&
+                    readArray(in, &hiddenWeights[0][0], NNUE_DENSE * 2 * NNUE_HIDDEN) &&
+                    readArray(in, hiddenBias, NNUE_DENSE) &&
+                    readArray(in, outputWeights, NNUE_DENSE) &&
+                    readArray(in, &outputBias, 1);
+    return complete && in.peek() == std::ifstream::traits_type::eof();
+}
+
+void NnueNetwork::addPieces(NnueAccumulator& accumulator, int pieceIndex, Bitboard squares) const {
+    while (squares) {
+        int square = popLowestSquare(squares);
+        for (int perspective = 0; perspective < 2; perspective++) {
+            int16_t* values = accumulator.values[perspective];
+            updateValues(values, values, featureWeights[nnueFeature(perspective, pieceIndex, square)], nullptr);
+        }
+    }
+}
+
+void NnueNetwork::removePieces(NnueAccumulator& accumulator, int pieceIndex, Bitboard squares) const {
+    while (squares) {
+        int square = popLowestSquare(squares);
+        for (int perspective = 0; perspective < 2; perspective++) {
+            int16_t* values = accumulator.values[perspective];
+            updateValues(values, values, nullptr, featureWeights[nnueFeature(perspective, pieceIndex, square)]);
+        }
+    }
+}
+
+void NnueNetwork::refresh(NnueAccumulator& accumulator, const Board& board) const {
+    for (int perspective = 0; perspective < 2; perspective++) {
+        std::copy(featureBias, featureBias + NNUE_HIDDEN, accumulator.values[perspective]);
+    }
+    addPieces(accumulator, pieceIndex(PieceType::WHITE_PAWN), board.pawns<Color::WHITE>());
+    addPieces(accumulator, pieceIndex(PieceType::BLACK_PAWN), board.pawns<Color::BLACK>());
+    addPieces(accumulator, pieceIndex(PieceType::WHITE_KING), board.kings<Color::WHITE>());
+    addPieces(accumulator, pieceIndex(PieceType::BLACK_KING), board.kings<Color::BLACK>());
+}
+
+void NnueNetwork::applyMove(const NnueAccumulator& parent, NnueAccumulator& child, const MoveUndo& undo) const {
+    bool white = undo.piece == PieceType::WHITE_PAWN || undo.piece == PieceType::WHITE_KING;
+    PieceType king = white ? PieceType::WHITE_KING : PieceType::BLACK_KING;
+    int moved = pieceIndex(undo.piece);
+    int placed = pieceIndex(undo.promoted ? king : undo.piece);
+    for (int perspective = 0; perspective < 2; perspective++) {
+        updateValues(child.values[perspective], parent.values[perspective],
+                     featureWeights[nnueFeature(perspective, placed, undo.to)],
+                     featureWeights[nnueFeature(perspective, moved, undo.from)]);
+    }
+
+    removePieces(child, pieceIndex(white ? PieceType::BLACK_PAWN : PieceType::WHITE_PAWN), undo.capturedPawns);
+    removePieces(child, pieceIndex(white ? PieceType::BLACK_KING : PieceType::WHITE_KING), undo.capturedKings);
+}
+
+bool NnueNetwork::matches(const NnueAccumulator& accumulator, const Board& board) const {
+    NnueAccumulator fresh;
+    refresh(fresh, board);
+    return std::memcmp(&fresh, &accumulator, sizeof(NnueAccumulator)) == 0;
+}
+
+// Wynik z punktu widzenia strony na ruchu: jej perspektywa trafia na
+// pierwsza polowe wejscia warstwy gestej.
+int NnueNetwork::evaluate(const NnueAccumulator& accumulator, bool whiteToMove) const {
+    alignas(32) uint8_t input[2 * NNUE_HIDDEN];
+    int us = whiteToMove ? 0 : 1;
+    clippedActivation(accumulator.values[us], input);
+    clippedActivation(accumulator.values[1 - us], input + NNUE_HIDDEN);
+
+    alignas(32) uint8_t hidden[NNUE_DENSE];
+    for (int i = 0; i < NNUE_DENSE; i++) {
+        int32_t sum = hiddenBias[i] + dotProduct(input, hiddenWeights[i], 2 * NNUE_HIDDEN);
+        hidden[i] = static_cast<uint8_t>(std::clamp(sum >> HIDDEN_SHIFT, 0, ACTIVATION_MAX));
+    }
+
+    int32_t output = outputBias + dotProduct(hidden, outputWeights, NNUE_DENSE);
+    return std::clamp(output / OUTPUT_SCALE, -NNUE_MAX_SCORE, NNUE_MAX_SCORE);
+}
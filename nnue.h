@@ -0,0 +1,54 @@
+#ifndef NNUE_H
+#define NNUE_H
+
+#include "board.h"
+#include <cstdint>
+#include <string>
+
+// Siec oceny: rzadkie wejscia (rodzaj bierki, pole) widziane z perspektywy
+// obu stron, akumulator 2x128 liczony przyrostowo z ruchu, potem warstwy
+// geste 256 -> 32 -> 1 na liczbach calkowitych int8/int16.
+const int NNUE_INPUTS = 4 * NUM_SQUARES;
+const int NNUE_HIDDEN = 128;
+const int NNUE_DENSE = 32;
+// Wynik sieci jest ograniczony, zeby nie mieszal sie z wynikami wygranej
+const int NNUE_MAX_SCORE = 500;
+
+struct alignas(32) NnueAccumulator {
+    int16_t values[2][NNUE_HIDDEN]; // [0] perspektywa bialych, [1] czarnych
+};
+
+// Indeks wejscia dla danej perspektywy; czarne widza plansze obrocona
+// o 180 stopni z zamienionymi kolorami bierek.
+inline int nnueFeature(int perspective, int pieceIndex, int square) {
+    if (perspective == 1) {
+        pieceIndex ^= 1;
+        square = NUM_SQUARES - 1 - square;
+    }
+    return pieceIndex * NUM_SQUARES + square;
+}
+
+class NnueNetwork {
+private:
+    alignas(32) int16_t featureWeights[NNUE_INPUTS][NNUE_HIDDEN];
+    alignas(32) int16_t featureBias[NNUE_HIDDEN];
+    alignas(32) int8_t hiddenWeights[NNUE_DENSE][2 * NNUE_HIDDEN];
+    int32_t hiddenBias[NNUE_DENSE];
+    alignas(32) int8_t outputWeights[NNUE_DENSE];
+    int32_t outputBias;
+
+    void addPieces(NnueAccumulator& accumulator, int pieceIndex, Bitboard squares) const;
+    void removePieces(NnueAccumulator& accumulator, int pieceIndex, Bitboard squares) const;
+
+public:
+    // Wczytuje wagi z pliku binarnego; false gdy plik nie istnieje lub ma zly format.
+    bool load(const std::string& path);
+    void refresh(NnueAccumulator& accumulator, const Board& board) const;
+    // Akumulator pozycji po ruchu z akumulatora pozycji przed nim; przesuniecie
+    // bierki to jeden przebieg laczacy kopiowanie, dodanie i odjecie wag.
+    void applyMove(const NnueAccumulator& parent, NnueAccumulator& child, const MoveUndo& undo) const;
+    [[nodiscard]] bool matches(const NnueAccumulator& accumulator, const Board& board) const;
+    [[nodiscard]] int evaluate(const NnueAccumulator& accumulator, bool whiteToMove) const;
+};
+
+#endif
@@ -0,0 +1,143 @@
+#include "perft.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+namespace {
+// Wpis jak w tablicy transpozycji wyszukiwania: klucz zapisany jako XOR
+// z danymi, wiec wpis rozerwany przez rownolegly zapis sie nie zweryfikuje.
+struct PerftSlot {
+    std::atomic<uint64_t> check{0};
+    std::atomic<uint64_t> data{0}; // nodes << 8 | depth
+};
+
+// Tablica wspoldzielona przez wszystkie watki perft bez blokad.
+class PerftTable {
+private:
+    std::unique_ptr<PerftSlot[]> slots;
+    uint64_t mask;
+
+public:
+    explicit PerftTable(int sizeMb) : mask(0) {
+        size_t count = 1;
+        size_t bytes = static_cast<size_t>(sizeMb) * 1024 * 1024;
+        while (count * 2 * sizeof(PerftSlot) <= bytes) {
+            count *= 2;
+        }
+        slots = std::make_unique<PerftSlot[]>(count);
+        mask = count - 1;
+    }
+
+    bool probe(uint64_t key, int depth, uint64_t& nodes) const {
+        const PerftSlot& slot = slots[key & mask];
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        if ((slot.check.load(std::memory_order_relaxed) ^ data) != key || (data & 0xFF) != uint64_t(depth)) {
+            return false;
+        }
+        nodes = data >> 8;
+        return true;
+    }
+
+    void store(uint64_t key, int depth, uint64_t nodes) {
+        // Liczba wezlow musi zmiescic sie w 56 bitach
+        if (nodes >> 56) {
+            return;
+        }
+        uint64_t data = nodes << 8 | uint64_t(depth);
+        PerftSlot& slot = slots[key & mask];
+        slot.check.store(key ^ data, std::memory_order_relaxed);
+        slot.data.store(data, std::memory_order_relaxed);
+    }
+};
+
+template<Color C>
+uint64_t countNodes(Board& board, int depth, PerftTable& table) {
+    if (depth == 0) {
+        return 1;
+    }
+
+    MoveList moves = board.generateMoves<C>();
+    if (depth == 1) {
+        return moves.size();
+    }
+
+    uint64_t nodes = 0;
+    if (table.probe(board.getHash(), depth, nodes)) {
+        return nodes;
+    }
+
+    for (const Move& move : moves) {
+        MoveUndo undo = board.makeMove(move);
+        nodes += countNodes<opponent(C)>(board, depth - 1, table);
+        board.unmakeMove(undo);
+    }
+
+    table.store(board.getHash(), depth, nodes);
+    return nodes;
+}
+}
+
+Perft::Perft(int threads, int hashMb) : threads(threads < 1 ? 1 : threads), hashMb(hashMb) {}
+
+PerftResult Perft::run(const Board& board, int depth) const {
+    PerftResult result{0, 0.0, {}};
+    // Tablica jest tworzona przed pomiarem czasu, zeby zerowanie pamieci
+    // nie zanizalo liczby wezlow na sekunde
+    PerftTable table(hashMb);
+    auto start = std::chrono::steady_clock::now();
+
+    MoveList rootMoves = board.getAllMoves(board.isWhiteToMove());
+    std::vector<uint64_t> counts(rootMoves.size(), 0);
+    std::atomic<int> nextMove(0);
+
+    auto worker = [&]() {
+        Board workerBoard = board;
+        for (int i = nextMove++; i < rootMoves.size(); i = nextMove++) {
+            MoveUndo undo = workerBoard.makeMove(rootMoves[i]);
+            counts[i] = workerBoard.isWhiteToMove()
+                            ? countNodes<Color::WHITE>(workerBoard, depth - 1, table)
+                            : countNodes<Color::BLACK>(workerBoard, depth - 1, table);
+            workerBoard.unmakeMove(undo);
+        }
+    };
+
+    if (depth <= 0) {
+        result.nodes = 1;
+    } else {
+        std::vector<std::thread> pool;
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (std::thread& thread : pool) {
+            thread.join();
+        }
+
+        for (int i = 0; i < rootMoves.size(); i++) {
+            result.divide.emplace_back(rootMoves[i], counts[i]);
+            result.nodes += counts[i];
+        }
+    }
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+void Perft::printResult(const PerftResult& result, bool divide) {
+    if (divide) {
+        for (const auto& [move, nodes] : result.divide) {
+            Position from = move.fromPosition();
+            Position to = move.toPosition();
+            std::cout << "(" << from.row << "," << from.col << ") -> ("
+                      << to.row << "," << to.col << "): " << nodes << "\n";
+        }
+    }
+
+    std::cout << "Wezly: " << result.nodes << "\n";
+    std::cout << "Czas: " << result.seconds << " s\n";
+    if (result.seconds > 0) {
+        std::cout << "Wezly/s: " << static_cast<uint64_t>(result.nodes / result.seconds) << "\n";
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef PERFT_H
+#define PERFT_H
+
+#include "board.h"
+#include <vector>
+
+struct PerftResult {
+    uint64_t nodes;
+    double seconds;
+    std::vector<std::pair<Move, uint64_t>> divide;
+};
+
+// Liczy liscie drzewa ruchow do zadanej glebokosci. Ruchy z korzenia sa
+// rozdzielane miedzy watki, ktore wspoldziela jedna tablice transpozycji.
+class Perft {
+private:
+    int threads;
+    int hashMb;
+
+public:
+    explicit Perft(int threads = 1, int hashMb = 16);
+    [[nodiscard]] PerftResult run(const Board& board, int depth) const;
+    static void printResult(const PerftResult& result, bool divide);
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef PIECESQUARETABLES_H
+#define PIECESQUARETABLES_H
+
+#include "bitboard.h"
+
+// Wartosc bierki (material + pozycja) na kazdym polu, indeksowana [PieceType - 1][pole].
+// Wartosci czarnych sa ujemne, wiec suma po planszy to przewaga bialych.
+struct PieceSquareTables {
+    std::array<std::array<int, NUM_SQUARES>, 4> value{};
+};
+
+constexpr int PAWN_VALUE = 10;
+constexpr int KING_VALUE = 30;
+constexpr int CENTER_BONUS = 2;
+// Premia za awans pionka, indeksowana wierszem liczonym od pola promocji
+constexpr int PAWN_ADVANCE_BONUS[8] = {0, 4, 3, 2, 1, 0, 0, 0};
+
+constexpr PieceSquareTables makePieceSquareTables() {
+    PieceSquareTables tables;
+    for (int square = 0; square < NUM_SQUARES; square++) {
+        int row = squareRow(square);
+        int col = squareCol(square);
+        int center = row >= 2 && row <= 5 && col >= 2 && col <= 5 ? CENTER_BONUS : 0;
+        tables.value[0][square] = PAWN_VALUE + center + PAWN_ADVANCE_BONUS[row];
+        tables.value[1][square] = -(PAWN_VALUE + center + PAWN_ADVANCE_BONUS[7 - row]);
+        tables.value[2][square] = KING_VALUE + center;
+        tables.value[3][square] = -(KING_VALUE + center);
+    }
+    return tables;
+}
+
+inline constexpr PieceSquareTables PST = makePieceSquareTables();
+
+inline int pieceSquareMaskValue(int pieceIndex, Bitboard squares) {
+    int value = 0;
+    while (squares) {
+        value += PST.value[pieceIndex][popLowestSquare(squares)];
+    }
+    return value;
+}
+
+#endif
@@ -0,0 +1,47 @@
+#include "searchBenchmark.h"
+#include "searchEngine.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+// Limit czasu tak duzy, ze wyszukiwanie konczy sie na zadanej glebokosci
+const int BENCHMARK_MOVE_TIME_MS = 24 * 60 * 60 * 1000;
+}
+
+SearchBenchmark::SearchBenchmark(int depth, ParallelMode mode) : depth(depth), mode(mode) {}
+
+std::vector<ScalingResult> SearchBenchmark::run(const std::vector<int>& threadCounts) const {
+    std::vector<ScalingResult> results;
+    for (int threads : threadCounts) {
+        SearchLimits limits;
+        limits.maxDepth = depth;
+        limits.moveTimeMs = BENCHMARK_MOVE_TIME_MS;
+        limits.threads = threads;
+        limits.parallelMode = mode;
+        SearchEngine engine(limits);
+
+        auto start = std::chrono::steady_clock::now();
+        engine.search(Board());
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        results.push_back(ScalingResult{threads, engine.getStats().nodes, seconds});
+    }
+    return results;
+}
+
+void SearchBenchmark::printResults(const std::vector<ScalingResult>& results) {
+    if (results.empty()) {
+        return;
+    }
+
+    const ScalingResult& base = results.front();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Watki | Wezly | Czas (s) | Przyspieszenie | Efektywnosc wezlow\n";
+    for (const ScalingResult& result : results) {
+        double speedup = result.seconds > 0 ? base.seconds / result.seconds : 0.0;
+        double nodeEfficiency = result.nodes ? 100.0 * base.nodes / result.nodes : 0.0;
+        std::cout << result.threads << " | " << result.nodes << " | " << result.seconds << " | "
+                  << speedup << "x | " << nodeEfficiency << "%\n";
+    }
+    std::cout << std::defaultfloat;
+}
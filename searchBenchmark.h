@@ -0,0 +1,27 @@
+#ifndef SEARCHBENCHMARK_H
+#define SEARCHBENCHMARK_H
+
+#include "searchThread.h"
+#include <vector>
+
+struct ScalingResult {
+    int threads;
+    uint64_t nodes;
+    double seconds;
+};
+
+// Mierzy skalowanie wyszukiwania rownoleglego: ta sama pozycja jest
+// przeszukiwana na stala glebokosc kolejno dla kazdej liczby watkow.
+class SearchBenchmark {
+private:
+    int depth;
+    ParallelMode mode;
+
+public:
+    SearchBenchmark(int depth, ParallelMode mode);
+    [[nodiscard]] std::vector<ScalingResult> run(const std::vector<int>& threadCounts) const;
+    // Przyspieszenie i efektywnosc wezlow liczone wzgledem pierwszego wyniku.
+    static void printResults(const std::vector<ScalingResult>& results);
+};
+
+#endif
@@ -0,0 +1,603 @@
+#include "searchEngine.h"
+#include "evaluation.h"
+#include <algorithm>
+#include <thread>
+
+namespace {
+// Watki pomocnicze Lazy SMP pomijaja co pewien czas serie iteracji: watek
+// z wpisem i przeszukuje glebokosc d tylko, gdy ((d + SKIP_PHASE[i]) / SKIP_SIZE[i])
+// jest parzyste. Dzieki temu przy wielu rdzeniach watki sa rozlozone na
+// rozne glebokosci, a nie powtarzaja iteracji watku glownego.
+constexpr int SKIP_ENTRIES = 20;
+constexpr int SKIP_SIZE[SKIP_ENTRIES] = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+constexpr int SKIP_PHASE[SKIP_ENTRIES] = {0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
+bool skipsDepth(int threadId, int depth) {
+    if (threadId == 0) {
+        return false;
+    }
+    int entry = (threadId - 1) % SKIP_ENTRIES;
+    return (depth + SKIP_PHASE[entry]) / SKIP_SIZE[entry] % 2 != 0;
+}
+}
+
+SearchEngine::SearchEngine(const SearchLimits& limits, int hashMb)
+    : limits(limits), transpositionTable(hashMb), stopSearch(false), sharedNodes(0),
+      threads(std::max(limits.threads, 1)), ponderMove(0, 0), ponderHit(false) {
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].id = static_cast<int>(i);
+        threads[i].evalCache.resize(limits.evalCacheKb);
+    }
+
+    if (!limits.networkFile.empty()) {
+        network = std::make_unique<NnueNetwork>();
+        if (!network->load(limits.networkFile)) {
+            network.reset();
+        }
+    }
+}
+
+SearchEngine::~SearchEngine() {
+    stopPondering(Move(0, 0), 0);
+}
+
+Move SearchEngine::search(const Board& position) {
+    return search(position, limits.moveTimeMs);
+}
+
+Move SearchEngine::search(const Board& position, int budgetMs) {
+    searchTimer.start(budgetMs);
+    return runSearch(position);
+}
+
+// Zegar startuje w watku wywolujacym, zeby budzet mozna bylo zmienic od razu
+// po powrocie, zanim wyszukiwanie w tle faktycznie ruszy.
+std::future<Move> SearchEngine::searchAsync(const Board& position, int budgetMs) {
+    searchTimer.start(budgetMs);
+    return std::async(std::launch::async, [this, position]() {
+        return runSearch(position);
+    });
+}
+
+Move SearchEngine::runSearch(const Board& position) {
+    MoveList possibleMoves = position.getAllMoves(position.isWhiteToMove());
+    
+    if (possibleMoves.empty()) {
+        return Move(0, 0);
+    }
+    
+    searchStats.clear();
+    if (possibleMoves.size() == 1) {
+        return possibleMoves[0];
+    }
+
+    transpositionTable.newSearch();
+    stopSearch = false;
+    sharedNodes = 0;
+
+    for (SearchThread& thread : threads) {
+        thread.board = position;
+        thread.accumulatorTop = -1;
+        pushAccumulator(thread);
+        thread.ordering.newSearch();
+        thread.stats.clear();
+        thread.bestMove = possibleMoves[0];
+        thread.completedDepth = 0;
+    }
+
+    if (limits.parallelMode == ParallelMode::YBWC && threads.size() > 1) {
+        // Watki puli czekaja na rodzenstwo wystawione w punktach podzialu
+        pool = std::make_unique<WorkStealingPool>(static_cast<int>(threads.size()));
+        runThread(threads[0], possibleMoves);
+        stopSearch = true;
+        pool.reset();
+    } else {
+        // Watki pomocnicze przeszukuja ten sam korzen; wyniki wymieniaja tylko
+        // przez wspolna tablice transpozycji.
+        std::vector<std::thread> helpers;
+        for (size_t i = 1; i < threads.size(); i++) {
+            helpers.emplace_back([this, i, possibleMoves]() mutable {
+                runThread(threads[i], possibleMoves);
+            });
+        }
+        runThread(threads[0], possibleMoves);
+        stopSearch = true;
+        for (std::thread& helper : helpers) {
+            helper.join();
+        }
+    }
+
+    const SearchThread* best = &threads[0];
+    for (const SearchThread& thread : threads) {
+        searchStats.add(thread.stats);
+        if (thread.completedDepth > best->completedDepth) {
+            best = &thread;
+        }
+    }
+    searchStats.depth = best->completedDepth;
+    return best->bestMove;
+}
+
+// Flaga jest ustawiana ponownie, bo watek mogl jeszcze nie zaczac wyszukiwania
+Move SearchEngine::cancel(std::future<Move>& result) {
+    while (result.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready) {
+        stopSearch = true;
+    }
+    return result.get();
+}
+
+// Odpowiedz przeciwnika przewidziana z wariantu glownego: najlepszy ruch zapisany
+// w tablicy transpozycji dla pozycji po ruchu silnika.
+Move SearchEngine::predictReply(const Board& position) const {
+    TTEntry entry;
+    if (transpositionTable.probe(position.getHash(), entry)) {
+        for (const Move& move : position.getAllMoves(position.isWhiteToMove())) {
+            if (move == entry.bestMove) {
+                return move;
+            }
+        }
+    }
+    return Move(0, 0);
+}
+
+// W czasie ruchu przeciwnika silnik przeszukuje pozycje po przewidzianej odpowiedzi.
+void SearchEngine::startPondering(const Board& position) {
+    ponderHit = false;
+    ponderMove = predictReply(position);
+    if (ponderMove.isNull()) {
+        return;
+    }
+
+    Board ponderBoard = position;
+    ponderBoard.makeMove(ponderMove);
+    ponderResult = searchAsync(ponderBoard, PONDER_BUDGET_MS);
+}
+
+// Wywolywane przed wykonaniem ruchu przeciwnika. Gdy zagral przewidziany ruch,
+// wyszukiwanie w tle trwa dalej, a jego budzet liczony od poczatku myslenia
+// zostaje skrocony do budzetu na ten ruch - przy dlugim namysle przeciwnika
+// konczy sie od razu. W przeciwnym razie wyszukiwanie jest przerywane, a zwykle
+// startuje potem z wypelniona tablica transpozycji.
+void SearchEngine::stopPondering(const Move& playedMove, int budgetMs) {
+    if (!ponderResult.valid()) {
+        return;
+    }
+
+    if (!ponderHit && playedMove == ponderMove) {
+        ponderHit = true;
+        searchTimer.setBudget(budgetMs);
+        return;
+    }
+    cancel(ponderResult);
+    ponderHit = false;
+}
+
+// Wyszukiwanie po trafionej odpowiedzi; pusty future, gdy nie bylo trafienia.
+std::future<Move> SearchEngine::takePonderedSearch() {
+    if (!ponderHit) {
+        return std::future<Move>();
+    }
+    ponderHit = false;
+    return std::move(ponderResult);
+}
+
+void SearchEngine::printStats(std::ostream& out) const {
+    out << "Glebokosc: " << searchStats.depth << " | Wezly: " << searchStats.nodes
+        << " (w tym bicia na horyzoncie: " << searchStats.quiescenceNodes << ")"
+        << " | Odciecia na 1. ruchu: "
+        << searchStats.firstMoveCutoffRate() << "% | Ponowne przeszukania: "
+        << searchStats.researches << " PVS, " << searchStats.aspirationResearches << " aspiracja"
+        << " | Watki: " << threads.size() << " | Podzialy: " << searchStats.splits;
+    if (limits.evalCacheKb > 0) {
+        out << " | Pamiec ocen: " << searchStats.evalCacheHitRate() << "% trafien";
+    }
+    if (network) {
+        out << " | Ocena: siec neuronowa";
+    } else {
+        out << " | Leniwa ocena: " << searchStats.lazyEvalRate() << "% (" << searchStats.materialEvaluations
+            << " material, " << searchStats.fullEvaluations << " pelna)";
+    }
+}
+
+void SearchEngine::runThread(SearchThread& thread, MoveList& moves) {
+    if (thread.board.isWhiteToMove()) {
+        iterativeDeepening<Color::WHITE>(thread, moves);
+    } else {
+        iterativeDeepening<Color::BLACK>(thread, moves);
+    }
+}
+
+template<Color C>
+void SearchEngine::iterativeDeepening(SearchThread& thread, MoveList& moves) {
+    int previousScore = 0;
+    for (int depth = 1; depth <= limits.maxDepth; depth++) {
+        if (skipsDepth(thread.id, depth)) {
+            continue;
+        }
+
+        int delta = ASPIRATION_WINDOW;
+        int alpha = -INFINITE_SCORE;
+        int beta = INFINITE_SCORE;
+        // Okno aspiracji wokol wyniku ostatniej ukonczonej iteracji
+        if (thread.completedDepth >= 2) {
+            alpha = std::max(previousScore - delta, -INFINITE_SCORE);
+            beta = std::min(previousScore + delta, INFINITE_SCORE);
+        }
+
+        Move iterationMove = thread.bestMove;
+        int score = searchRoot<C>(thread, moves, depth, alpha, beta, iterationMove);
+        // Wynik poza oknem aspiracji - szukamy ponownie z szerszym oknem
+        while (!stopSearch && (score <= alpha || score >= beta)) {
+            thread.stats.aspirationResearches++;
+            delta *= 2;
+            if (score <= alpha) {
+                alpha = std::max(score - delta, -INFINITE_SCORE);
+            } else {
+                beta = std::min(score + delta, INFINITE_SCORE);
+            }
+            score = searchRoot<C>(thread, moves, depth, alpha, beta, iterationMove);
+        }
+        if (stopSearch) {
+            break;
+        }
+
+        thread.bestMove = iterationMove;
+        thread.completedDepth = depth;
+        previousScore = score;
+        if (score >= WIN_BOUND || score <= -WIN_BOUND) {
+            break;
+        }
+        // Brak czasu na kolejna, dluzsza iteracje; o zakonczeniu decyduje watek glowny
+        if (thread.id == 0 && searchTimer.elapsedMs() * 2 > searchTimer.getBudgetMs()) {
+            break;
+        }
+    }
+}
+
+template<Color C>
+int SearchEngine::searchRoot(SearchThread& thread, MoveList& moves, int depth, int alpha, int beta, Move& bestMove) {
+    const int originalAlpha = alpha;
+    MovePicker picker(moves, bestMove, 0, thread.ordering);
+    Move iterationBest = bestMove;
+    int bestScore = -INFINITE_SCORE;
+
+    Move move;
+    while (picker.next(move)) {
+        MoveUndo undo = makeMove(thread, move);
+        int score = principalVariationSearch<opponent(C)>(thread, depth - 1, 1, alpha, beta,
+                                                          picker.movesPicked() == 1);
+        unmakeMove(thread, undo);
+        if (stopSearch) {
+            return bestScore;
+        }
+        
+        if (score > bestScore) {
+            bestScore = score;
+            if (score > alpha) {
+                iterationBest = move;
+                alpha = score;
+                if (alpha >= beta) {
+                    break;
+                }
+            }
+        }
+    }
+
+    if (bestScore > originalAlpha) {
+        bestMove = iterationBest;
+    }
+    Bound bound = bestScore <= originalAlpha ? Bound::UPPER
+                : bestScore >= beta ? Bound::LOWER
+                : Bound::EXACT;
+    transpositionTable.store(thread.board.getHash(), depth, scoreToTable(bestScore, 0), bound, bestMove);
+    return bestScore;
+}
+
+// Pierwszy ruch dostaje pelne okno, pozostale okno zerowe; gdy ruch okaze sie
+// lepszy od alpha, wynik jest weryfikowany ponownym przeszukaniem.
+template<Color C>
+int SearchEngine::principalVariationSearch(SearchThread& thread, int depth, int ply, int alpha, int beta, bool firstMove) {
+    if (firstMove) {
+        return -negamax<C>(thread, depth, ply, -beta, -alpha);
+    }
+
+    int score = -negamax<C>(thread, depth, ply, -alpha - 1, -alpha);
+    if (score > alpha && score < beta && !aborted(thread)) {
+        thread.stats.researches++;
+        score = -negamax<C>(thread, depth, ply, -beta, -alpha);
+    }
+    return score;
+}
+
+template<Color C>
+int SearchEngine::negamax(SearchThread& thread, int depth, int ply, int alpha, int beta) {
+    if (depth == 0) {
+        return quiescence<C>(thread, ply, alpha, beta);
+    }
+
+    const int originalAlpha = alpha;
+    if ((++thread.stats.nodes & 1023) == 0) {
+        pollLimits();
+    }
+    if (aborted(thread)) {
+        return 0;
+    }
+
+    Board& tempBoard = thread.board;
+    Move hashMove(0, 0);
+    TTEntry entry;
+    if (transpositionTable.probe(tempBoard.getHash(), entry)) {
+        int hashScore = scoreFromTable(entry.score, ply);
+        if (entry.depth >= depth &&
+            (entry.bound == Bound::EXACT ||
+             (entry.bound == Bound::LOWER && hashScore >= beta) ||
+             (entry.bound == Bound::UPPER && hashScore <= alpha))) {
+            return hashScore;
+        }
+        hashMove = entry.bestMove;
+    }
+
+    if (!tempBoard.hasAnyMove<C>()) {
+        return -WIN_SCORE + ply;
+    }
+    
+    MoveList moves = tempBoard.generateMoves<C>();
+    MovePicker picker(moves, hashMove, ply, thread.ordering);
+    Move bestMove = moves[0];
+    int bestScore = -INFINITE_SCORE;
+
+    Move move;
+    while (picker.next(move)) {
+        MoveUndo undo = makeMove(thread, move);
+        int score = principalVariationSearch<opponent(C)>(thread, depth - 1, ply + 1, alpha, beta,
+                                                          picker.movesPicked() == 1);
+        unmakeMove(thread, undo);
+        if (aborted(thread)) {
+            return 0;
+        }
+
+        if (score > bestScore) {
+            bestScore = score;
+            bestMove = move;
+            if (score > alpha) {
+                alpha = score;
+                if (alpha >= beta) {
+                    thread.stats.betaCutoffs++;
+                    if (picker.movesPicked() == 1) {
+                        thread.stats.firstMoveCutoffs++;
+                    }
+                    if (!move.isCapture()) {
+                        thread.ordering.recordCutoff(move, ply, depth);
+                    }
+                    break;
+                }
+            }
+        }
+
+        // Pierwszy ruch przeszukany bez odciecia - reszte moga przejac inne watki
+        if (pool && depth >= MIN_SPLIT_DEPTH && picker.movesPicked() == 1 && moves.size() > 1) {
+            splitSearch<C>(thread, picker, depth, ply, alpha, beta, bestScore, bestMove);
+            if (aborted(thread)) {
+                return 0;
+            }
+            break;
+        }
+    }
+    
+    Bound bound = bestScore <= originalAlpha ? Bound::UPPER
+                : bestScore >= beta ? Bound::LOWER
+                : Bound::EXACT;
+    transpositionTable.store(tempBoard.getHash(), depth, scoreToTable(bestScore, ply), bound, bestMove);
+    return bestScore;
+}
+
+// Wystawia pozostale ruchy wezla jako zadania puli i do czasu ich zakonczenia
+// sam wykonuje zadania z kolejek, zeby nie blokowac watku.
+template<Color C>
+void SearchEngine::splitSearch(SearchThread& thread, MovePicker& picker, int depth, int ply, int alpha, int beta,
+                       int& bestScore, Move& bestMove) {
+    SplitPoint split(thread.splitPoint, alpha, beta, bestScore, bestMove);
+    thread.stats.splits++;
+
+    Move move;
+    while (picker.next(move)) {
+        split.pending++;
+        pool->push(thread.id, [this, &split, position = thread.board, move, depth, ply](int worker) {
+            searchSplitMove<C>(threads[worker], split, position, move, depth, ply);
+        });
+    }
+    while (split.pending > 0) {
+        if (!pool->runOne(thread.id)) {
+            std::this_thread::yield();
+        }
+    }
+
+    bestScore = split.bestScore;
+    bestMove = split.bestMove;
+}
+
+template<Color C>
+void SearchEngine::searchSplitMove(SearchThread& thread, SplitPoint& split, const Board& position, const Move& move,
+                           int depth, int ply) {
+    if (!stopSearch && !split.cancelled()) {
+        // Watek mogl przyjsc tu w trakcie wlasnego wyszukiwania - odtwarzamy jego stan
+        Board savedBoard = thread.board;
+        const SplitPoint* savedSplit = thread.splitPoint;
+        int savedAccumulatorTop = thread.accumulatorTop;
+        thread.board = position;
+        thread.splitPoint = &split;
+        pushAccumulator(thread);
+
+        makeMove(thread, move);
+        int score = principalVariationSearch<opponent(C)>(thread, depth - 1, ply + 1, split.alpha, split.beta, false);
+        if (!aborted(thread)) {
+            std::lock_guard<std::mutex> lock(split.mutex);
+            if (score > split.bestScore) {
+                split.bestScore = score;
+                split.bestMove = move;
+                if (score > split.alpha) {
+                    split.alpha = score;
+                    if (score >= split.beta) {
+                        split.cutoff = true;
+                        thread.stats.betaCutoffs++;
+                        if (!move.isCapture()) {
+                            thread.ordering.recordCutoff(move, ply, depth);
+                        }
+                    }
+                }
+            }
+        }
+
+        thread.board = savedBoard;
+        thread.splitPoint = savedSplit;
+        thread.accumulatorTop = savedAccumulatorTop;
+    }
+    split.pending--;
+}
+
+// Ruch na planszy watku; z siecia na stos trafia akumulator nowej pozycji,
+// wiec cofniecie ruchu tylko go zdejmuje.
+MoveUndo SearchEngine::makeMove(SearchThread& thread, const Move& move) {
+    MoveUndo undo = thread.board.makeMove(move);
+    if (network) {
+        if (thread.accumulatorTop + 1 == static_cast<int>(thread.accumulators.size())) {
+            thread.accumulators.emplace_back();
+        }
+        network->applyMove(thread.accumulators[thread.accumulatorTop],
+                           thread.accumulators[thread.accumulatorTop + 1], undo);
+        thread.accumulatorTop++;
+        assert(network->matches(thread.accumulators[thread.accumulatorTop], thread.board));
+    }
+    return undo;
+}
+
+void SearchEngine::unmakeMove(SearchThread& thread, const MoveUndo& undo) {
+    thread.board.unmakeMove(undo);
+    if (network) {
+        thread.accumulatorTop--;
+    }
+}
+
+// Akumulator liczony od zera, gdy plansza watku zostala podmieniona
+void SearchEngine::pushAccumulator(SearchThread& thread) {
+    if (!network) {
+        return;
+    }
+    if (thread.accumulatorTop + 1 == static_cast<int>(thread.accumulators.size())) {
+        thread.accumulators.emplace_back();
+    }
+    thread.accumulatorTop++;
+    network->refresh(thread.accumulators[thread.accumulatorTop], thread.board);
+}
+
+// Tablica przechowuje wygrane liczone od wezla, a nie od korzenia, zeby
+// ten sam wpis byl poprawny na kazdej glebokosci, na ktorej pozycja wystapi.
+int SearchEngine::scoreToTable(int score, int ply) {
+    if (score >= WIN_BOUND) return score + ply;
+    if (score <= -WIN_BOUND) return score - ply;
+    return score;
+}
+
+int SearchEngine::scoreFromTable(int score, int ply) {
+    if (score >= WIN_BOUND) return score - ply;
+    if (score <= -WIN_BOUND) return score + ply;
+    return score;
+}
+
+bool SearchEngine::aborted(const SearchThread& thread) const {
+    return stopSearch || (thread.splitPoint && thread.splitPoint->cancelled());
+}
+
+// Wywolywane co 1024 wezly kazdego watku; licznik wspolny sluzy limitowi wezlow.
+void SearchEngine::pollLimits() {
+    uint64_t searched = sharedNodes += 1024;
+    if (searchTimer.expired() || (limits.maxNodes && searched >= limits.maxNodes)) {
+        stopSearch = true;
+    }
+}
+
+// Na horyzoncie rozgrywamy bicia do konca. Bicie jest obowiazkowe, wiec ocena
+// statyczna (stand pat) jest dozwolona tylko w pozycji bez bicia.
+template<Color C>
+int SearchEngine::quiescence(SearchThread& thread, int ply, int alpha, int beta) {
+    thread.stats.quiescenceNodes++;
+    if ((++thread.stats.nodes & 1023) == 0) {
+        pollLimits();
+    }
+    if (aborted(thread)) {
+        return 0;
+    }
+
+    Board& tempBoard = thread.board;
+    MoveList captures;
+    tempBoard.generateCaptures<C>(captures);
+    if (captures.empty()) {
+        if (!tempBoard.hasAnyMove<C>()) {
+            return -WIN_SCORE + ply;
+        }
+        return evaluatePosition<C>(thread, alpha, beta);
+    }
+
+    MovePicker picker(captures, Move(0, 0), ply, thread.ordering);
+    int bestScore = -INFINITE_SCORE;
+
+    Move move;
+    while (picker.next(move)) {
+        MoveUndo undo = makeMove(thread, move);
+        int score = -quiescence<opponent(C)>(thread, ply + 1, -beta, -alpha);
+        unmakeMove(thread, undo);
+        if (aborted(thread)) {
+            return 0;
+        }
+
+        if (score > bestScore) {
+            bestScore = score;
+            if (score > alpha) {
+                alpha = score;
+                if (alpha >= beta) {
+                    break;
+                }
+            }
+        }
+    }
+
+    return bestScore;
+}
+
+// Ocena liscia przez pamiec ocen watku i leniwa ocene albo siec. Klucz pozycji
+// zawiera strone na ruchu, a C to zawsze strona na ruchu, wiec zapisana ocena
+// ma wlasciwy znak. Zapisywane sa tylko pelne oceny, bo sam material zalezy od okna.
+template<Color C>
+int SearchEngine::evaluatePosition(SearchThread& thread, int alpha, int beta) {
+    uint64_t key = thread.board.getHash();
+    int score;
+    if (thread.evalCache.enabled()) {
+        thread.stats.evalCacheProbes++;
+        if (thread.evalCache.probe(key, score)) {
+            thread.stats.evalCacheHits++;
+            return score;
+        }
+    }
+
+    if (network) {
+        // Siec nie ma taniego przyblizenia z marginesem - zawsze pelna ocena
+        score = network->evaluate(thread.accumulators[thread.accumulatorTop], C == Color::WHITE);
+        thread.stats.fullEvaluations++;
+        if (thread.evalCache.enabled()) {
+            thread.evalCache.store(key, score);
+        }
+        return score;
+    }
+
+    EvalTier tier;
+    score = evaluate<C>(thread.board, alpha, beta, tier);
+    if (tier == EvalTier::MATERIAL) {
+        thread.stats.materialEvaluations++;
+        return score;
+    }
+    thread.stats.fullEvaluations++;
+    if (thread.evalCache.enabled()) {
+        thread.evalCache.store(key, score);
+    }
+    return score;
+}
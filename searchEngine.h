@@ -0,0 +1,106 @@
+#ifndef SEARCHENGINE_H
+#define SEARCHENGINE_H
+
+#include "board.h"
+#include "transpositionTable.h"
+#include "moveOrdering.h"
+#include "searchStats.h"
+#include "searchThread.h"
+#include "timeManager.h"
+#include "workStealingPool.h"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+constexpr int MAX_SEARCH_DEPTH = 48;
+
+// Ograniczenia i konfiguracja wyszukiwania; maxNodes == 0 oznacza brak limitu
+// wezlow, evalCacheKb == 0 wylacza pamiec ocen. Gdy networkFile jest pusty lub
+// nie da sie go wczytac, uzywana jest recznie pisana ocena.
+struct SearchLimits {
+    int maxDepth = MAX_SEARCH_DEPTH;
+    uint64_t maxNodes = 0;
+    int moveTimeMs = 1000;
+    int threads = 1;
+    ParallelMode parallelMode = ParallelMode::LAZY_SMP;
+    int evalCacheKb = 256; // na watek
+    std::string networkFile;
+};
+
+// Silnik gry bez zaleznosci od interfejsu: wyszukiwanie alfa-beta z tablica
+// transpozycji, wieloma watkami i mysleniem w czasie ruchu przeciwnika.
+// Jednoczesnie moze trwac tylko jedno wyszukiwanie.
+class SearchEngine {
+private:
+    SearchLimits limits;
+    TranspositionTable transpositionTable;
+    SearchStats searchStats;
+    SearchTimer searchTimer;
+    std::atomic<bool> stopSearch;
+    std::atomic<uint64_t> sharedNodes;
+    std::vector<SearchThread> threads;
+    std::unique_ptr<WorkStealingPool> pool;
+    std::unique_ptr<NnueNetwork> network;
+
+    std::future<Move> ponderResult;
+    Move ponderMove;
+    bool ponderHit; // ponderResult to juz wyszukiwanie wlasciwego ruchu
+
+    // Przegrana w ply ruchach ma wynik -WIN_SCORE + ply; wszystko powyzej
+    // WIN_BOUND co do modulu to wygrana lub przegrana, a nie ocena pozycji.
+    static constexpr int WIN_SCORE = 1000;
+    static constexpr int WIN_BOUND = WIN_SCORE - 2 * MAX_SEARCH_DEPTH;
+    static constexpr int INFINITE_SCORE = 32000;
+    static constexpr int ASPIRATION_WINDOW = 12;
+    static constexpr int MIN_SPLIT_DEPTH = 4;
+    // Myslenie w czasie ruchu przeciwnika trwa az do jego ruchu
+    static constexpr int PONDER_BUDGET_MS = 24 * 60 * 60 * 1000;
+
+public:
+    explicit SearchEngine(const SearchLimits& limits = SearchLimits(), int hashMb = 16);
+    ~SearchEngine();
+    SearchEngine(const SearchEngine&) = delete;
+    SearchEngine& operator=(const SearchEngine&) = delete;
+
+    Move search(const Board& position);
+    Move search(const Board& position, int budgetMs);
+    std::future<Move> searchAsync(const Board& position, int budgetMs);
+    Move cancel(std::future<Move>& result);
+
+    [[nodiscard]] Move predictReply(const Board& position) const;
+    void startPondering(const Board& position);
+    void stopPondering(const Move& playedMove, int budgetMs);
+    std::future<Move> takePonderedSearch();
+
+    [[nodiscard]] const SearchStats& getStats() const { return searchStats; }
+    [[nodiscard]] const SearchLimits& getLimits() const { return limits; }
+    [[nodiscard]] bool usesNetwork() const { return network != nullptr; }
+    void printStats(std::ostream& out) const;
+
+private:
+    Move runSearch(const Board& position);
+    void runThread(SearchThread& thread, MoveList& moves);
+    template<Color C> void iterativeDeepening(SearchThread& thread, MoveList& moves);
+    template<Color C> int searchRoot(SearchThread& thread, MoveList& moves, int depth, int alpha, int beta, Move& bestMove);
+    template<Color C> int principalVariationSearch(SearchThread& thread, int depth, int ply, int alpha, int beta, bool firstMove);
+    template<Color C> [[nodiscard]] int negamax(SearchThread& thread, int depth, int ply, int alpha, int beta);
+    template<Color C> [[nodiscard]] int quiescence(SearchThread& thread, int ply, int alpha, int beta);
+    template<Color C> [[nodiscard]] int evaluatePosition(SearchThread& thread, int alpha, int beta);
+    template<Color C> void splitSearch(SearchThread& thread, MovePicker& picker, int depth, int ply, int alpha, int beta,
+                                       int& bestScore, Move& bestMove);
+    template<Color C> void searchSplitMove(SearchThread& thread, SplitPoint& split, const Board& position,
+                                           const Move& move, int depth, int ply);
+    [[nodiscard]] bool aborted(const SearchThread& thread) const;
+    MoveUndo makeMove(SearchThread& thread, const Move& move);
+    void unmakeMove(SearchThread& thread, const MoveUndo& undo);
+    void pushAccumulator(SearchThread& thread);
+    static int scoreToTable(int score, int ply);
+    static int scoreFromTable(int score, int ply);
+    void pollLimits();
+};
+
+#endif
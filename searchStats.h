@@ -0,0 +1,55 @@
+#ifndef SEARCHSTATS_H
+#define SEARCHSTATS_H
+
+#include <cstdint>
+
+struct SearchStats {
+    int depth = 0;
+    uint64_t nodes = 0;
+    uint64_t quiescenceNodes = 0;
+    uint64_t betaCutoffs = 0;
+    uint64_t firstMoveCutoffs = 0;
+    uint64_t researches = 0;
+    uint64_t aspirationResearches = 0;
+    uint64_t splits = 0;
+    uint64_t evalCacheProbes = 0;
+    uint64_t evalCacheHits = 0;
+    uint64_t materialEvaluations = 0;
+    uint64_t fullEvaluations = 0;
+
+    void clear() {
+        *this = SearchStats();
+    }
+
+    // Sumuje liczniki innego watku; glebokosc pozostaje ta z watku glownego.
+    void add(const SearchStats& other) {
+        nodes += other.nodes;
+        quiescenceNodes += other.quiescenceNodes;
+        betaCutoffs += other.betaCutoffs;
+        firstMoveCutoffs += other.firstMoveCutoffs;
+        researches += other.researches;
+        aspirationResearches += other.aspirationResearches;
+        splits += other.splits;
+        evalCacheProbes += other.evalCacheProbes;
+        evalCacheHits += other.evalCacheHits;
+        materialEvaluations += other.materialEvaluations;
+        fullEvaluations += other.fullEvaluations;
+    }
+
+    // Odsetek odciec beta uzyskanych juz na pierwszym ruchu - miara jakosci sortowania.
+    [[nodiscard]] double firstMoveCutoffRate() const {
+        return betaCutoffs ? 100.0 * firstMoveCutoffs / betaCutoffs : 0.0;
+    }
+
+    [[nodiscard]] double evalCacheHitRate() const {
+        return evalCacheProbes ? 100.0 * evalCacheHits / evalCacheProbes : 0.0;
+    }
+
+    // Odsetek ocen zakonczonych na samym materiale - do strojenia marginesu leniwej oceny.
+    [[nodiscard]] double lazyEvalRate() const {
+        uint64_t evaluations = materialEvaluations + fullEvaluations;
+        return evaluations ? 100.0 * materialEvaluations / evaluations : 0.0;
+    }
+};
+
+#endif
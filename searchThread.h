@@ -0,0 +1,60 @@
+#ifndef SEARCHTHREAD_H
+#define SEARCHTHREAD_H
+
+#include "board.h"
+#include "evalCache.h"
+#include "moveOrdering.h"
+#include "nnue.h"
+#include "searchStats.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// LAZY_SMP: kazdy watek przeszukuje caly korzen, wspolna jest tylko tablica transpozycji.
+// YBWC: jeden watek prowadzi wyszukiwanie, pozostale przejmuja rodzenstwo w punktach podzialu.
+enum class ParallelMode {
+    LAZY_SMP = 0,
+    YBWC = 1
+};
+
+// Wezel, ktorego ruchy po pierwszym (Young Brothers Wait) sa przeszukiwane
+// rownolegle. Odciecie beta anuluje pozostale ruchy tego wezla i calego poddrzewa.
+struct SplitPoint {
+    const SplitPoint* parent;
+    std::mutex mutex;
+    std::atomic<int> alpha;
+    const int beta;
+    int bestScore;
+    Move bestMove;
+    std::atomic<int> pending;
+    std::atomic<bool> cutoff;
+
+    SplitPoint(const SplitPoint* parent, int alpha, int beta, int bestScore, const Move& bestMove)
+        : parent(parent), alpha(alpha), beta(beta), bestScore(bestScore), bestMove(bestMove),
+          pending(0), cutoff(false) {}
+
+    [[nodiscard]] bool cancelled() const {
+        for (const SplitPoint* split = this; split; split = split->parent) {
+            if (split->cutoff) return true;
+        }
+        return false;
+    }
+};
+
+// Prywatny stan jednego watku wyszukiwania. Wyrownanie do linii pamieci
+// podrecznej, zeby liczniki sasiednich watkow nie wspoldzielily linii.
+struct alignas(64) SearchThread {
+    int id = 0;
+    Board board;
+    MoveOrdering ordering;
+    EvalCache evalCache;
+    // Stos akumulatorow sieci, wierzcholek opisuje board; uzywany tylko z siecia
+    std::vector<NnueAccumulator> accumulators;
+    int accumulatorTop = 0;
+    SearchStats stats;
+    Move bestMove;
+    int completedDepth = 0;
+    const SplitPoint* splitPoint = nullptr;
+};
+
+#endif
@@ -0,0 +1,98 @@
+#include "timeManager.h"
+#include <algorithm>
+
+namespace {
+const int MOVES_TO_GO = 20;
+const int SAFETY_MARGIN_MS = 50;
+const int MIN_BUDGET_MS = 10;
+
+int sideIndex(Color side) {
+    return static_cast<int>(side);
+}
+}
+
+GameClock::GameClock(const TimeControl& control) : control(control) {
+    reset();
+}
+
+void GameClock::reset() {
+    remainingMs[0] = remainingMs[1] = control.baseTimeMs;
+    flagged[0] = flagged[1] = false;
+    running = false;
+    runningSide = Color::WHITE;
+}
+
+void GameClock::startTurn(Color side) {
+    running = true;
+    runningSide = side;
+    turnStart = std::chrono::steady_clock::now();
+}
+
+void GameClock::stopTurn(Color side) {
+    if (!running || runningSide != side) return;
+
+    running = false;
+    if (!usesClock()) return;
+
+    int64_t& remainingTime = remainingMs[sideIndex(side)];
+    remainingTime -= std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - turnStart).count();
+    if (remainingTime <= 0) {
+        remainingTime = 0;
+        flagged[sideIndex(side)] = true;
+    } else {
+        remainingTime += control.incrementMs;
+    }
+}
+
+int64_t GameClock::remaining(Color side) const {
+    int64_t remainingTime = remainingMs[sideIndex(side)];
+    if (running && runningSide == side) {
+        remainingTime -= std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - turnStart).count();
+    }
+    return std::max<int64_t>(remainingTime, 0);
+}
+
+bool GameClock::isFlagged(Color side) const {
+    return usesClock() && (flagged[sideIndex(side)] || remaining(side) == 0);
+}
+
+int GameClock::moveBudgetMs(Color side) const {
+    if (!usesClock()) {
+        return control.moveTimeMs;
+    }
+
+    int64_t remainingTime = remaining(side);
+    int64_t budget = remainingTime / MOVES_TO_GO + control.incrementMs * 3 / 4;
+    budget = std::min(budget, remainingTime - SAFETY_MARGIN_MS);
+    return static_cast<int>(std::max<int64_t>(budget, MIN_BUDGET_MS));
+}
+
+std::string GameClock::format(int64_t ms) {
+    int64_t seconds = ms / 1000;
+    std::string minutesText = std::to_string(seconds / 60);
+    std::string secondsText = std::to_string(seconds % 60);
+    if (secondsText.size() < 2) {
+        secondsText = "0" + secondsText;
+    }
+    return minutesText + ":" + secondsText;
+}
+
+void SearchTimer::start(int budgetMs) {
+    startTime = std::chrono::steady_clock::now();
+    budget = budgetMs;
+}
+
+void SearchTimer::setBudget(int budgetMs) {
+    budget = budgetMs;
+}
+
+bool SearchTimer::expired() const {
+    return elapsedMs() >= budget;
+}
+
+int64_t SearchTimer::elapsedMs() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+}
@@ -0,0 +1,54 @@
+#ifndef TIMEMANAGER_H
+#define TIMEMANAGER_H
+
+#include "board.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+
+// Staly czas na ruch komputera albo zegar Fischera (czas bazowy + dodatek za ruch).
+struct TimeControl {
+    int moveTimeMs = 1000;
+    int baseTimeMs = 0;
+    int incrementMs = 0;
+
+    [[nodiscard]] bool usesClock() const { return moveTimeMs <= 0 && baseTimeMs > 0; }
+};
+
+class GameClock {
+private:
+    TimeControl control;
+    int64_t remainingMs[2];
+    bool flagged[2];
+    bool running;
+    Color runningSide;
+    std::chrono::steady_clock::time_point turnStart;
+
+public:
+    explicit GameClock(const TimeControl& control);
+    void reset();
+    void startTurn(Color side);
+    void stopTurn(Color side);
+    [[nodiscard]] bool isRunning() const { return running; }
+    [[nodiscard]] bool usesClock() const { return control.usesClock(); }
+    [[nodiscard]] int64_t remaining(Color side) const;
+    [[nodiscard]] bool isFlagged(Color side) const;
+    [[nodiscard]] int moveBudgetMs(Color side) const;
+    static std::string format(int64_t ms);
+};
+
+// Budzet mozna zmienic z innego watku w trakcie wyszukiwania; liczy sie od startu.
+class SearchTimer {
+private:
+    std::chrono::steady_clock::time_point startTime;
+    std::atomic<int64_t> budget{0};
+
+public:
+    void start(int budgetMs);
+    void setBudget(int budgetMs);
+    [[nodiscard]] int64_t getBudgetMs() const { return budget; }
+    [[nodiscard]] bool expired() const;
+    [[nodiscard]] int64_t elapsedMs() const;
+};
+
+#endif
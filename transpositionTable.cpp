@@ -0,0 +1,92 @@
+#include "transpositionTable.h"
+
+TranspositionTable::TranspositionTable(int sizeMb) : mask(0), generation(0) {
+    size_t count = 1;
+    size_t bytes = static_cast<size_t>(sizeMb) * 1024 * 1024;
+    while (count * 2 * sizeof(TTBucket) <= bytes) {
+        count *= 2;
+    }
+    buckets = std::make_unique<TTBucket[]>(count);
+    mask = count - 1;
+    clear();
+}
+
+void TranspositionTable::clear() {
+    for (uint64_t i = 0; i <= mask; i++) {
+        for (TTSlot* slot : {&buckets[i].deepest, &buckets[i].recent}) {
+            slot->check.store(0, std::memory_order_relaxed);
+            slot->data.store(0, std::memory_order_relaxed);
+            slot->captured.store(0, std::memory_order_relaxed);
+        }
+    }
+    generation = 0;
+}
+
+void TranspositionTable::newSearch() {
+    generation++;
+}
+
+// Uklad slowa danych: from | to << 8 | score << 16 | depth << 32 | bound << 40 | generation << 48.
+uint64_t TranspositionTable::pack(const TTEntry& entry) {
+    return uint64_t(entry.bestMove.from)
+         | uint64_t(entry.bestMove.to) << 8
+         | uint64_t(uint16_t(entry.score)) << 16
+         | uint64_t(uint8_t(entry.depth)) << 32
+         | uint64_t(entry.bound) << 40
+         | uint64_t(entry.generation) << 48;
+}
+
+TTEntry TranspositionTable::unpack(uint64_t data, uint64_t captured) {
+    TTEntry entry;
+    entry.bestMove = Move(data & 0xFF, (data >> 8) & 0xFF, static_cast<Bitboard>(captured));
+    entry.score = static_cast<int16_t>(data >> 16);
+    entry.depth = static_cast<int8_t>(data >> 32);
+    entry.bound = static_cast<Bound>((data >> 40) & 0xFF);
+    entry.generation = static_cast<uint8_t>(data >> 48);
+    return entry;
+}
+
+bool TranspositionTable::read(const TTSlot& slot, uint64_t key, TTEntry& entry) {
+    uint64_t data = slot.data.load(std::memory_order_relaxed);
+    uint64_t captured = slot.captured.load(std::memory_order_relaxed);
+    if ((slot.check.load(std::memory_order_relaxed) ^ data ^ captured) != key) {
+        return false;
+    }
+    entry = unpack(data, captured);
+    return entry.depth > 0;
+}
+
+void TranspositionTable::write(TTSlot& slot, uint64_t key, uint64_t data, uint64_t captured) {
+    slot.check.store(key ^ data ^ captured, std::memory_order_relaxed);
+    slot.data.store(data, std::memory_order_relaxed);
+    slot.captured.store(captured, std::memory_order_relaxed);
+}
+
+bool TranspositionTable::probe(uint64_t key, TTEntry& entry) const {
+    const TTBucket& bucket = buckets[key & mask];
+    return read(bucket.deepest, key, entry) || read(bucket.recent, key, entry);
+}
+
+void TranspositionTable::store(uint64_t key, int depth, int score, Bound bound, const Move& bestMove) {
+    TTBucket& bucket = buckets[key & mask];
+    uint8_t currentGeneration = generation;
+    uint64_t data = pack(TTEntry{bestMove, static_cast<int16_t>(score), static_cast<int8_t>(depth),
+                                 bound, currentGeneration});
+    uint64_t captured = bestMove.captured;
+
+    uint64_t deepestData = bucket.deepest.data.load(std::memory_order_relaxed);
+    uint64_t deepestCaptured = bucket.deepest.captured.load(std::memory_order_relaxed);
+    uint64_t deepestKey = bucket.deepest.check.load(std::memory_order_relaxed) ^ deepestData ^ deepestCaptured;
+    TTEntry deepest = unpack(deepestData, deepestCaptured);
+
+    // Glebszy wpis zostaje, chyba ze pochodzi z poprzedniego wyszukiwania
+    // albo dotyczy tej samej pozycji.
+    if (deepestKey == key || deepest.generation != currentGeneration || depth >= deepest.depth) {
+        if (deepestKey != key) {
+            write(bucket.recent, deepestKey, deepestData, deepestCaptured);
+        }
+        write(bucket.deepest, key, data, captured);
+    } else {
+        write(bucket.recent, key, data, captured);
+    }
+}
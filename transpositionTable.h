@@ -0,0 +1,58 @@
+#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include "board.h"
+#include <atomic>
+#include <memory>
+
+enum class Bound : uint8_t {
+    EXACT = 0,
+    LOWER = 1,
+    UPPER = 2
+};
+
+struct TTEntry {
+    Move bestMove;
+    int16_t score;
+    int8_t depth;
+    Bound bound;
+    uint8_t generation;
+};
+
+// Wpis zapisany w dwoch slowach danych; klucz jest przechowywany jako XOR
+// z danymi, wiec wpis rozerwany przez rownolegly zapis innego watku
+// nie przejdzie weryfikacji przy odczycie.
+struct TTSlot {
+    std::atomic<uint64_t> check{0};
+    std::atomic<uint64_t> data{0};
+    std::atomic<uint64_t> captured{0};
+};
+
+// Kubelek z dwoma wpisami: pierwszy trzyma najglebsze wyszukiwanie,
+// drugi jest nadpisywany zawsze.
+struct TTBucket {
+    TTSlot deepest;
+    TTSlot recent;
+};
+
+// Tablica wspoldzielona przez watki wyszukiwania bez blokad.
+class TranspositionTable {
+private:
+    std::unique_ptr<TTBucket[]> buckets;
+    uint64_t mask;
+    std::atomic<uint8_t> generation;
+
+    static uint64_t pack(const TTEntry& entry);
+    static TTEntry unpack(uint64_t data, uint64_t captured);
+    static bool read(const TTSlot& slot, uint64_t key, TTEntry& entry);
+    static void write(TTSlot& slot, uint64_t key, uint64_t data, uint64_t captured);
+
+public:
+    explicit TranspositionTable(int sizeMb = 16);
+    void clear();
+    void newSearch();
+    [[nodiscard]] bool probe(uint64_t key, TTEntry& entry) const;
+    void store(uint64_t key, int depth, int score, Bound bound, const Move& bestMove);
+};
+
+#endif
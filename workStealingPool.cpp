@@ -0,0 +1,62 @@
+#include "workStealingPool.h"
+
+WorkStealingPool::WorkStealingPool(int threadCount) : running(true) {
+    for (int i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (int i = 1; i < threadCount; i++) {
+        workers.emplace_back([this, i]() {
+            while (running) {
+                if (!runOne(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    running = false;
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::push(int worker, Task task) {
+    WorkerQueue& queue = *queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+}
+
+bool WorkStealingPool::popOwn(int worker, Task& task) {
+    WorkerQueue& queue = *queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(int worker, Task& task) {
+    for (int offset = 1; offset < size(); offset++) {
+        WorkerQueue& queue = *queues[(worker + offset) % size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingPool::runOne(int worker) {
+    Task task;
+    if (!popOwn(worker, task) && !steal(worker, task)) {
+        return false;
+    }
+    task(worker);
+    return true;
+}
@@ -0,0 +1,43 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pula watkow z osobna kolejka dla kazdego watku. Wlasciciel bierze zadania
+// z konca swojej kolejki, bezczynne watki kradna z poczatku cudzych kolejek.
+// Watek 0 to watek wywolujacy - nie jest tworzony przez pule.
+class WorkStealingPool {
+public:
+    using Task = std::function<void(int worker)>;
+
+private:
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<bool> running;
+
+    bool popOwn(int worker, Task& task);
+    bool steal(int worker, Task& task);
+
+public:
+    explicit WorkStealingPool(int threadCount);
+    ~WorkStealingPool();
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    void push(int worker, Task task);
+    bool runOne(int worker);
+    [[nodiscard]] int size() const { return static_cast<int>(queues.size()); }
+};
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include "bitboard.h"
+
+// Klucze losowane w czasie kompilacji (splitmix64), indeksowane [PieceType - 1][pole].
+struct ZobristKeys {
+    std::array<std::array<uint64_t, NUM_SQUARES>, 4> piece{};
+    uint64_t blackToMove = 0;
+};
+
+constexpr uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+constexpr ZobristKeys makeZobristKeys() {
+    ZobristKeys keys;
+    uint64_t state = 0x5741524341425921ull;
+    for (auto& squares : keys.piece) {
+        for (uint64_t& key : squares) {
+            key = splitMix64(state);
+        }
+    }
+    keys.blackToMove = splitMix64(state);
+    return keys;
+}
+
+inline constexpr ZobristKeys ZOBRIST = makeZobristKeys();
+
+inline uint64_t zobristMaskKey(int pieceIndex, Bitboard squares) {
+    uint64_t key = 0;
+    while (squares) {
+        key ^= ZOBRIST.piece[pieceIndex][popLowestSquare(squares)];
+    }
+    return key;
+}
+
+#endif